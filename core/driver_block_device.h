@@ -0,0 +1,122 @@
+/**
+ * @file driver_block_device.h
+ * @brief 通用块设备接口 (Generic Block Device Interface)
+ * @note  所有函数指针必须携带 void *ctx 上下文参数 (指向具体后端的设备句柄)
+ *
+ * @section block_device_purpose 设计目的
+ * 日志、键值存储、配置存储等上层模块只依赖本接口, 即可在 EEPROM、
+ * SPI Flash、FRAM 等不同存储器之间迁移, 无需改写上层代码.
+ *
+ * @section block_device_geometry 几何信息
+ * 上层通过 get_geometry() 获取编程页大小与编程延迟:
+ * - 写入按 page_size 对齐并以整页为单位批量提交, 每页只消耗一次编程周期
+ * - program_latency_us 用于估算写入耗时和安排非阻塞轮询的间隔
+ * - erase_required 为 false 的存储器 (EEPROM/FRAM) 可直接改写, 无需先擦除
+ *
+ * @section block_device_async 非阻塞操作
+ * program_async() 只发出写入即返回, 之后由调用者周期性调用 poll() 推进.
+ * 存储器处于内部编程周期期间总线可用于其他设备. 异步接口为可选项,
+ * 后端不支持时置为 NULL.
+ */
+
+#ifndef _DRIVER_BLOCK_DEVICE_H_
+#define _DRIVER_BLOCK_DEVICE_H_
+
+#include "driver_interfaces.h"
+
+/* --- 1. 几何信息 (Geometry) --- */
+typedef struct {
+    uint32_t capacity;               /**< 总容量 (bytes) */
+    uint32_t read_size;              /**< 最小读取单位 (bytes) */
+    uint32_t program_size;           /**< 最小编程单位 (bytes) */
+    uint32_t page_size;              /**< 编程页大小: 单次编程不跨页, 按页对齐批量写入效率最高 */
+    uint32_t erase_size;             /**< 擦除单位 (bytes) */
+    uint32_t program_latency_us;     /**< 单页编程时间典型值 (us) */
+    uint32_t program_max_latency_us; /**< 单页编程时间上限 (us), 超过即视为超时 */
+    uint32_t erase_latency_us;       /**< 单个擦除单位的擦除时间典型值 (us) */
+    uint8_t  erase_value;            /**< 擦除后的字节值 (如 0xFF) */
+    bool     erase_required;         /**< 改写前是否必须先擦除 */
+} driver_block_geometry_t;
+
+/* --- 2. 块设备操作接口 (Block Device Operations) --- */
+typedef struct {
+    /**
+     * @brief 读取数据
+     * @param ctx 后端设备句柄
+     * @param address 起始地址
+     * @param p_data 读取数据缓冲区
+     * @param len 读取长度 (read_size 的整数倍)
+     * @return driver_status_t
+     */
+    driver_status_t (*read)(void *ctx, uint32_t address, uint8_t *p_data, uint32_t len);
+
+    /**
+     * @brief 编程 (写入) 数据 (阻塞式, 返回时数据已写入存储单元)
+     * @param ctx 后端设备句柄
+     * @param address 起始地址
+     * @param p_data 写入数据
+     * @param len 写入长度 (program_size 的整数倍)
+     * @return driver_status_t
+     * @note  erase_required 为 true 时, 目标区域必须已擦除
+     */
+    driver_status_t (*program)(void *ctx, uint32_t address, const uint8_t *p_data, uint32_t len);
+
+    /**
+     * @brief 擦除区域 (阻塞式)
+     * @param ctx 后端设备句柄
+     * @param address 起始地址 (erase_size 对齐)
+     * @param len 擦除长度 (erase_size 的整数倍)
+     * @return driver_status_t
+     */
+    driver_status_t (*erase)(void *ctx, uint32_t address, uint32_t len);
+
+    /**
+     * @brief 同步: 等待所有进行中的编程/擦除完成
+     * @param ctx 后端设备句柄
+     * @return driver_status_t 进行中任务的最终结果
+     */
+    driver_status_t (*sync)(void *ctx);
+
+    /**
+     * @brief 获取几何信息
+     * @param ctx 后端设备句柄
+     * @param p_geometry 输出几何信息
+     * @return driver_status_t
+     * @note  编程延迟可能随后端的运行时统计更新, 需要时可重复获取
+     */
+    driver_status_t (*get_geometry)(void *ctx, driver_block_geometry_t *p_geometry);
+
+    /**
+     * @brief 启动非阻塞编程 (可选)
+     * @param ctx 后端设备句柄
+     * @param address 起始地址
+     * @param p_data 写入数据 (完成前必须保持有效)
+     * @param len 写入长度
+     * @param cb 完成回调 (可为NULL), 在 poll() 的调用上下文中执行
+     * @param user_data 回调用户数据
+     * @return driver_status_t
+     * @retval DRV_ERR_BUSY 已有任务在进行
+     */
+    driver_status_t (*program_async)(void *ctx, uint32_t address, const uint8_t *p_data, uint32_t len,
+                                     driver_completion_callback_t cb, void *user_data);
+
+    /**
+     * @brief 推进非阻塞操作 (可选)
+     * @param ctx 后端设备句柄
+     * @return driver_status_t
+     * @retval DRV_OK 无进行中的任务
+     * @retval DRV_ERR_BUSY 任务仍在进行, 需稍后再次调用
+     * @retval 其他 任务失败 (已终止)
+     */
+    driver_status_t (*poll)(void *ctx);
+
+    void *reserved;
+} driver_block_device_ops_t;
+
+/* --- 3. 块设备句柄 (Block Device Handle) --- */
+typedef struct {
+    const driver_block_device_ops_t *p_ops;  /**< 后端操作接口 */
+    void *ctx;                               /**< 后端设备句柄, 作为 ctx 传入各操作 */
+} driver_block_device_t;
+
+#endif /* _DRIVER_BLOCK_DEVICE_H_ */
@@ -0,0 +1,127 @@
+/**
+ * @file driver_crc.h
+ * @brief 通用 CRC 校验 (CRC-8 / CRC-16-CCITT / CRC-32)
+ * @note  用于存储与通信数据完整性校验, 支持分段增量计算.
+ *
+ * @section crc_algorithms 算法参数
+ * | 算法 | 多项式 | 初值 | 反射 | 结果异或 | 说明 |
+ * |:---|:---|:---|:---|:---|:---|
+ * | CRC-8 | 0x07 | 0x00 | 否 | 0x00 | SMBus PEC |
+ * | CRC-16-CCITT | 0x1021 | 0xFFFF | 否 | 0x0000 | CCITT-FALSE |
+ * | CRC-32 | 0x04C11DB7 | 0xFFFFFFFF | 是 | 0xFFFFFFFF | IEEE 802.3 / zlib |
+ *
+ * @section crc_impl 实现选择
+ * 通过编译宏 DRV_CRC_IMPL 在代码体积与速度之间取舍:
+ * - DRV_CRC_IMPL_BITWISE: 逐位计算, 无查找表
+ * - DRV_CRC_IMPL_NIBBLE : 16项半字节查找表 (默认, 适合 Flash 紧张的 MCU)
+ * - DRV_CRC_IMPL_TABLE  : 256项查找表
+ * - DRV_CRC_IMPL_SLICE8 : CRC-32 使用 slicing-by-8 (8KB 查找表, 适合主机),
+ *                         CRC-8/CRC-16 使用256项查找表
+ *
+ * 各实现的主机实测 (examples/driver_crc_bench.c, x86-64; 查找表为 CRC-8 + CRC-16 + CRC-32 合计,
+ * text 为 gcc -Os 编译 driver_crc.c 的代码段, 包含查找表; 吞吐量为 gcc -O2, 多次运行波动约 5%):
+ * | 实现 | 查找表 | text | CRC-8 (MB/s) | CRC-16 (MB/s) | CRC-32 (MB/s) |
+ * |:---|:---|:---|:---|:---|:---|
+ * | BITWISE | 0 B | 442 B | 约 80 | 约 78 | 约 80 |
+ * | NIBBLE | 112 B | 623 B | 约 142 | 约 136 | 约 171 |
+ * | TABLE | 1.75 KB | 2215 B | 约 370 | 约 273 | 约 328 |
+ * | SLICE8 | 8.75 KB | 9589 B | 约 370 | 约 274 | 约 1550 |
+ *
+ * @section crc_incremental 增量计算
+ * @code
+ * uint32_t crc = DRV_CRC32_INIT;
+ * crc = driver_crc32_update(crc, p_header, header_len);
+ * crc = driver_crc32_update(crc, p_payload, payload_len);
+ * crc = DRV_CRC32_FINAL(crc);
+ * @endcode
+ */
+
+#ifndef _DRIVER_CRC_H_
+#define _DRIVER_CRC_H_
+
+#include "driver_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 实现选择 (Implementation Selection) --- */
+#define DRV_CRC_IMPL_BITWISE    0   /**< 逐位计算 */
+#define DRV_CRC_IMPL_NIBBLE     1   /**< 16项半字节查找表 */
+#define DRV_CRC_IMPL_TABLE      2   /**< 256项查找表 */
+#define DRV_CRC_IMPL_SLICE8     3   /**< slicing-by-8 (仅 CRC-32) */
+
+#ifndef DRV_CRC_IMPL
+#define DRV_CRC_IMPL            DRV_CRC_IMPL_NIBBLE
+#endif
+
+/* --- 2. 算法参数 (Algorithm Parameters) --- */
+#define DRV_CRC8_INIT           0x00U
+#define DRV_CRC16_CCITT_INIT    0xFFFFU
+#define DRV_CRC32_INIT          0xFFFFFFFFUL
+#define DRV_CRC32_FINAL(crc)    ((uint32_t)((crc) ^ 0xFFFFFFFFUL))
+
+/* --- 3. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief CRC-8 增量计算
+ * @param crc 当前CRC值 (首段传入 DRV_CRC8_INIT)
+ * @param p_data 数据
+ * @param length 数据长度
+ * @return 更新后的CRC值
+ */
+uint8_t driver_crc8_update(uint8_t crc, const uint8_t *p_data, uint32_t length);
+
+/**
+ * @brief CRC-16-CCITT 增量计算
+ * @param crc 当前CRC值 (首段传入 DRV_CRC16_CCITT_INIT)
+ * @param p_data 数据
+ * @param length 数据长度
+ * @return 更新后的CRC值
+ */
+uint16_t driver_crc16_ccitt_update(uint16_t crc, const uint8_t *p_data, uint32_t length);
+
+/**
+ * @brief CRC-32 增量计算
+ * @param crc 当前CRC寄存器值 (首段传入 DRV_CRC32_INIT)
+ * @param p_data 数据
+ * @param length 数据长度
+ * @return 更新后的CRC寄存器值 (全部数据处理完后经 DRV_CRC32_FINAL 得到结果)
+ */
+uint32_t driver_crc32_update(uint32_t crc, const uint8_t *p_data, uint32_t length);
+
+/**
+ * @brief 计算 CRC-8 (单次)
+ */
+uint8_t driver_crc8(const uint8_t *p_data, uint32_t length);
+
+/**
+ * @brief 计算 CRC-16-CCITT (单次)
+ */
+uint16_t driver_crc16_ccitt(const uint8_t *p_data, uint32_t length);
+
+/**
+ * @brief 计算 CRC-32 (单次, 已包含结果异或)
+ */
+uint32_t driver_crc32(const uint8_t *p_data, uint32_t length);
+
+/**
+ * @brief 计算 CRC-16-CCITT 并以大端追加在数据之后 (记录封装)
+ * @param p_data 数据, 缓冲区至少 length + 2 字节
+ * @param length CRC 覆盖的数据长度
+ */
+void driver_crc16_ccitt_append(uint8_t *p_data, uint32_t length);
+
+/**
+ * @brief 校验数据之后大端存放的 CRC-16-CCITT
+ * @param p_data 数据, 至少 length + 2 字节
+ * @param length CRC 覆盖的数据长度
+ * @return true 校验通过
+ */
+bool driver_crc16_ccitt_check(const uint8_t *p_data, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DRIVER_CRC_H_ */
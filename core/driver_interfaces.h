@@ -130,7 +130,37 @@ typedef struct {
      */
     driver_status_t (*read_reg_async)(void *ctx, uint8_t dev_addr, uint8_t reg_addr, uint8_t *p_data, uint32_t len,
                                        driver_completion_callback_t cb, void *user_data);
-    
+
+    /**
+     * @brief I2C 组合写读 (可选): 先写 p_tx, 再以重复起始条件读取, 整体为一次总线传输
+     * @param ctx 总线句柄
+     * @param dev_addr 设备7位地址
+     * @param p_tx 写阶段数据 (如多字节存储器地址)
+     * @param tx_len 写阶段长度
+     * @param p_rx 读数据缓冲区
+     * @param rx_len 读长度
+     * @return driver_status_t
+     * @note  用于寄存器/存储器地址超过1字节的随机读取; 为NULL时由驱动自行回退
+     */
+    driver_status_t (*write_read)(void *ctx, uint8_t dev_addr, const uint8_t *p_tx, uint32_t tx_len,
+                                  uint8_t *p_rx, uint32_t rx_len);
+
+    /**
+     * @brief I2C 异步组合写读 (可选, 使用DMA或中断)
+     * @param ctx 总线句柄
+     * @param dev_addr 设备7位地址
+     * @param p_tx 写阶段数据 (传输完成前必须保持有效)
+     * @param tx_len 写阶段长度
+     * @param p_rx 读数据缓冲区
+     * @param rx_len 读长度
+     * @param cb 完成回调函数
+     * @param user_data 用户数据，会透传给回调
+     * @return driver_status_t
+     */
+    driver_status_t (*write_read_async)(void *ctx, uint8_t dev_addr, const uint8_t *p_tx, uint32_t tx_len,
+                                        uint8_t *p_rx, uint32_t rx_len,
+                                        driver_completion_callback_t cb, void *user_data);
+
     void *reserved;
 } driver_i2c_ops_t;
 
@@ -49,13 +49,65 @@ static driver_status_t i2c_adapter_read_reg(void *user_data,
     return DRV_OK;
 }
 
+static driver_status_t i2c_adapter_write_read(void *user_data,
+                                               uint8_t dev_addr,
+                                               const uint8_t *p_tx,
+                                               uint32_t tx_len,
+                                               uint8_t *p_rx,
+                                               uint32_t rx_len)
+{
+    I2C_HandleTypeDef *p_hi2c = (I2C_HandleTypeDef *)user_data;
+    HAL_StatusTypeDef hal_status;
+    uint16_t mem_addr;
+    uint16_t mem_size;
+
+    /* HAL_I2C_Mem_Read 即为 地址写入 + 重复起始读取 的组合传输 */
+    if (tx_len == 2) {
+        mem_addr = DRV_MAKE_U16(p_tx[0], p_tx[1]);
+        mem_size = I2C_MEMADD_SIZE_16BIT;
+    } else if (tx_len == 1) {
+        mem_addr = p_tx[0];
+        mem_size = I2C_MEMADD_SIZE_8BIT;
+    } else {
+        return DRV_ERR_NOT_SUPPORT;
+    }
+
+    hal_status = HAL_I2C_Mem_Read(p_hi2c, dev_addr, mem_addr,
+                                   mem_size, p_rx, rx_len, 100);
+    if (hal_status != HAL_OK) {
+        return DRV_ERR_IO;
+    }
+
+    return DRV_OK;
+}
+
+static void time_adapter_delay_us(uint32_t us)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles = us * (SystemCoreClock / 1000000U);
+
+    while ((DWT->CYCCNT - start) < cycles) {
+    }
+}
+
+static uint32_t time_adapter_get_tick(void)
+{
+    return HAL_GetTick();
+}
+
 /* --- 4. 初始化函数 (Initialization) --- */
 
 void at24cxx_example_init(void)
 {
     driver_i2c_ops_t i2c_ops = {
         .write_reg = i2c_adapter_write_reg,
-        .read_reg = i2c_adapter_read_reg
+        .read_reg = i2c_adapter_read_reg,
+        .write_read = i2c_adapter_write_read
+    };
+
+    driver_time_ops_t time_ops = {
+        .delay_us = time_adapter_delay_us,
+        .get_tick = time_adapter_get_tick
     };
 
     at24cxx_config_t config = AT24CXX_GET_DEFAULT_CONFIG(AT24CXX_MODEL_128);
@@ -63,6 +115,7 @@ void at24cxx_example_init(void)
     config.device_addr = 0x50;
 
     at24cxx_init(&g_at24c128_dev, &i2c_ops, &config, &hi2c1);
+    at24cxx_set_time_ops(&g_at24c128_dev, &time_ops);
 }
 
 /* --- 5. 示例1: 基础读写 (Example 1: Basic Read/Write) --- */
@@ -293,7 +346,7 @@ void at24cxx_example_device_probe(void)
     if (status == DRV_OK) {
         printf("Device Address: 0x%02X\n", config.device_addr);
         printf("Page Size: %d bytes\n", config.page_size);
-        printf("Capacity: %d bytes\n", config.capacity);
+        printf("Capacity: %lu bytes\n", (unsigned long)config.capacity);
         printf("Address Bytes: %d\n", config.addr_bytes);
     }
 }
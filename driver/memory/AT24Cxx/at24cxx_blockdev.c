@@ -0,0 +1,113 @@
+#include "at24cxx_blockdev.h"
+
+/* --- 1. 私有函数声明 (Private Functions) --- */
+
+static driver_status_t static_read(void *ctx, uint32_t address, uint8_t *p_data, uint32_t len);
+static driver_status_t static_program(void *ctx, uint32_t address, const uint8_t *p_data, uint32_t len);
+static driver_status_t static_erase(void *ctx, uint32_t address, uint32_t len);
+static driver_status_t static_sync(void *ctx);
+static driver_status_t static_get_geometry(void *ctx, driver_block_geometry_t *p_geometry);
+static driver_status_t static_program_async(void *ctx, uint32_t address, const uint8_t *p_data, uint32_t len,
+                                            driver_completion_callback_t cb, void *user_data);
+static driver_status_t static_poll(void *ctx);
+
+/* 操作接口表 (只读, 设备状态全部位于 ctx 指向的设备句柄中) */
+static const driver_block_device_ops_t s_at24cxx_block_ops = {
+    .read = static_read,
+    .program = static_program,
+    .erase = static_erase,
+    .sync = static_sync,
+    .get_geometry = static_get_geometry,
+    .program_async = static_program_async,
+    .poll = static_poll,
+    .reserved = NULL
+};
+
+/* --- 2. 公共函数实现 (Public Functions) --- */
+
+driver_status_t at24cxx_blockdev_init(driver_block_device_t *p_bdev,
+                                      at24cxx_dev_t *p_dev)
+{
+    if (p_bdev == NULL || p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_bdev->p_ops = &s_at24cxx_block_ops;
+    p_bdev->ctx = p_dev;
+
+    return DRV_OK;
+}
+
+/* --- 3. 私有函数实现 (Private Functions) --- */
+
+static driver_status_t static_read(void *ctx, uint32_t address, uint8_t *p_data, uint32_t len)
+{
+    return at24cxx_read((at24cxx_dev_t *)ctx, address, p_data, len);
+}
+
+static driver_status_t static_program(void *ctx, uint32_t address, const uint8_t *p_data, uint32_t len)
+{
+    return at24cxx_write((at24cxx_dev_t *)ctx, address, p_data, len);
+}
+
+static driver_status_t static_erase(void *ctx, uint32_t address, uint32_t len)
+{
+    return at24cxx_erase((at24cxx_dev_t *)ctx, address, len);
+}
+
+static driver_status_t static_sync(void *ctx)
+{
+    at24cxx_dev_t *p_dev = (at24cxx_dev_t *)ctx;
+    driver_status_t status;
+
+    status = at24cxx_write_step(p_dev);
+    while (status == DRV_ERR_BUSY) {
+        /* 芯片处于写周期中: 按轮询间隔等待, 避免空转占满总线 */
+        if (p_dev->has_time_ops) {
+            p_dev->time_ops.delay_us(p_dev->config.poll_interval_us);
+        }
+        status = at24cxx_write_step(p_dev);
+    }
+
+    return status;
+}
+
+static driver_status_t static_get_geometry(void *ctx, driver_block_geometry_t *p_geometry)
+{
+    at24cxx_dev_t *p_dev = (at24cxx_dev_t *)ctx;
+    uint32_t twr_us;
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_geometry == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    /* 优先使用实测写周期估计值, 尚无统计时按数据手册上限报告 */
+    twr_us = p_dev->write_stats.estimate_twr_us;
+    if (twr_us == 0) {
+        twr_us = AT24CXX_BLOCKDEV_DEFAULT_TWR_US;
+    }
+
+    p_geometry->capacity = p_dev->config.capacity;
+    p_geometry->read_size = 1;
+    p_geometry->program_size = 1;
+    p_geometry->page_size = p_dev->config.page_size;
+    p_geometry->erase_size = 1;
+    p_geometry->program_latency_us = twr_us;
+    p_geometry->program_max_latency_us = p_dev->config.write_timeout_ms * 1000U;
+    p_geometry->erase_latency_us = twr_us;
+    p_geometry->erase_value = 0xFF;
+    p_geometry->erase_required = false;
+
+    return DRV_OK;
+}
+
+static driver_status_t static_program_async(void *ctx, uint32_t address, const uint8_t *p_data, uint32_t len,
+                                            driver_completion_callback_t cb, void *user_data)
+{
+    return at24cxx_write_begin((at24cxx_dev_t *)ctx, address, p_data, len, cb, user_data);
+}
+
+static driver_status_t static_poll(void *ctx)
+{
+    return at24cxx_write_step((at24cxx_dev_t *)ctx);
+}
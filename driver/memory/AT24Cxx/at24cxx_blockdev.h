@@ -0,0 +1,41 @@
+/**
+ * @file at24cxx_blockdev.h
+ * @brief AT24Cxx 块设备后端 (Block Device Backend)
+ * @note  将 AT24Cxx 设备包装为通用块设备 (driver_block_device_t).
+ *        EEPROM 可按字节改写, 报告 erase_required = false;
+ *        编程页大小取自设备配置, 编程延迟取自运行时写周期统计.
+ */
+
+#ifndef AT24CXX_BLOCKDEV_H
+#define AT24CXX_BLOCKDEV_H
+
+#include "at24cxx_driver.h"
+#include "../../../core/driver_block_device.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#ifndef AT24CXX_BLOCKDEV_DEFAULT_TWR_US
+#define AT24CXX_BLOCKDEV_DEFAULT_TWR_US  5000U  /**< 尚无写周期统计时报告的编程延迟 (数据手册 tWR 上限) */
+#endif
+
+/* --- 2. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 将 AT24Cxx 设备绑定为块设备
+ * @param p_bdev 块设备句柄指针
+ * @param p_dev 已初始化的EEPROM设备 (作为块设备的 ctx)
+ * @return driver_status_t
+ * @note  操作接口为只读常量表, 多个块设备可共享
+ */
+driver_status_t at24cxx_blockdev_init(driver_block_device_t *p_bdev,
+                                      at24cxx_dev_t *p_dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT24CXX_BLOCKDEV_H */
@@ -0,0 +1,382 @@
+#include "at24cxx_cache.h"
+#include <string.h>
+
+/* --- 1. 私有函数声明 (Private Functions) --- */
+
+static driver_status_t static_get_frame(at24cxx_cache_t *p_cache,
+                                        uint16_t page_index,
+                                        at24cxx_cache_frame_t **pp_frame);
+static driver_status_t static_flush_frame(at24cxx_cache_t *p_cache,
+                                          at24cxx_cache_frame_t *p_frame);
+static void static_mark_dirty(at24cxx_cache_t *p_cache,
+                              at24cxx_cache_frame_t *p_frame,
+                              uint16_t offset);
+
+/* --- 2. 公共函数实现 (Public Functions) --- */
+
+driver_status_t at24cxx_cache_init(at24cxx_cache_t *p_cache,
+                                   at24cxx_dev_t *p_dev,
+                                   at24cxx_cache_frame_t *p_frames,
+                                   uint8_t *p_frame_buf,
+                                   uint16_t frame_count)
+{
+    uint16_t i;
+
+    if (p_cache == NULL || p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_frames == NULL || p_frame_buf == NULL || frame_count == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    memset(p_cache, 0, sizeof(at24cxx_cache_t));
+
+    p_cache->p_dev = p_dev;
+    p_cache->p_frames = p_frames;
+    p_cache->frame_count = frame_count;
+    p_cache->page_size = p_dev->config.page_size;
+
+    for (i = 0; i < frame_count; i++) {
+        memset(&p_frames[i], 0, sizeof(at24cxx_cache_frame_t));
+        p_frames[i].p_data = p_frame_buf + (uint32_t)i * p_cache->page_size;
+    }
+
+    p_cache->is_initialized = true;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_cache_read(at24cxx_cache_t *p_cache,
+                                   uint32_t address,
+                                   uint8_t *p_data,
+                                   uint32_t length)
+{
+    at24cxx_cache_frame_t *p_frame;
+    uint32_t done;
+    uint16_t offset;
+    uint16_t chunk;
+    uint32_t current_addr;
+    driver_status_t status;
+
+    if (p_cache == NULL || !p_cache->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_data == NULL || length == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (address >= p_cache->p_dev->config.capacity ||
+        length > p_cache->p_dev->config.capacity - address) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    done = 0;
+    while (done < length) {
+        current_addr = address + done;
+        offset = (uint16_t)(current_addr % p_cache->page_size);
+        chunk = p_cache->page_size - offset;
+        if (chunk > length - done) {
+            chunk = (uint16_t)(length - done);
+        }
+
+        status = static_get_frame(p_cache, (uint16_t)(current_addr / p_cache->page_size), &p_frame);
+        if (status != DRV_OK) {
+            return status;
+        }
+
+        memcpy(p_data + done, p_frame->p_data + offset, chunk);
+        done += chunk;
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_cache_write(at24cxx_cache_t *p_cache,
+                                    uint32_t address,
+                                    const uint8_t *p_data,
+                                    uint32_t length)
+{
+    at24cxx_cache_frame_t *p_frame;
+    uint32_t done;
+    uint16_t offset;
+    uint16_t chunk;
+    uint32_t current_addr;
+    uint16_t i;
+    driver_status_t status;
+
+    if (p_cache == NULL || !p_cache->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_data == NULL || length == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (address >= p_cache->p_dev->config.capacity ||
+        length > p_cache->p_dev->config.capacity - address) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    done = 0;
+    while (done < length) {
+        current_addr = address + done;
+        offset = (uint16_t)(current_addr % p_cache->page_size);
+        chunk = p_cache->page_size - offset;
+        if (chunk > length - done) {
+            chunk = (uint16_t)(length - done);
+        }
+
+        status = static_get_frame(p_cache, (uint16_t)(current_addr / p_cache->page_size), &p_frame);
+        if (status != DRV_OK) {
+            return status;
+        }
+
+        /* 无缓存时每个页片段都对应一次页写入 */
+        p_cache->stats.logical_write_count++;
+
+        for (i = 0; i < chunk; i++) {
+            if (p_frame->p_data[offset + i] != p_data[done + i]) {
+                p_frame->p_data[offset + i] = p_data[done + i];
+                static_mark_dirty(p_cache, p_frame, offset + i);
+            }
+        }
+
+        done += chunk;
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_cache_read_byte(at24cxx_cache_t *p_cache,
+                                        uint32_t address,
+                                        uint8_t *p_data)
+{
+    return at24cxx_cache_read(p_cache, address, p_data, 1);
+}
+
+driver_status_t at24cxx_cache_write_byte(at24cxx_cache_t *p_cache,
+                                         uint32_t address,
+                                         uint8_t data)
+{
+    return at24cxx_cache_write(p_cache, address, &data, 1);
+}
+
+driver_status_t at24cxx_cache_flush(at24cxx_cache_t *p_cache)
+{
+    uint16_t i;
+    driver_status_t status;
+
+    if (p_cache == NULL || !p_cache->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    for (i = 0; i < p_cache->frame_count; i++) {
+        status = static_flush_frame(p_cache, &p_cache->p_frames[i]);
+        if (status != DRV_OK) {
+            return status;
+        }
+    }
+
+    p_cache->has_dirty = false;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_cache_set_flush_interval(at24cxx_cache_t *p_cache,
+                                                 uint32_t interval_ms)
+{
+    if (p_cache == NULL || !p_cache->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (interval_ms != 0 && !p_cache->p_dev->has_time_ops) {
+        return DRV_ERR_NOT_SUPPORT;
+    }
+
+    p_cache->flush_interval_ms = interval_ms;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_cache_poll(at24cxx_cache_t *p_cache)
+{
+    uint32_t elapsed_ms;
+
+    if (p_cache == NULL || !p_cache->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (!p_cache->has_dirty || p_cache->flush_interval_ms == 0) {
+        return DRV_OK;
+    }
+
+    elapsed_ms = p_cache->p_dev->time_ops.get_tick() - p_cache->dirty_since_tick;
+    if (elapsed_ms < p_cache->flush_interval_ms) {
+        return DRV_OK;
+    }
+
+    return at24cxx_cache_flush(p_cache);
+}
+
+driver_status_t at24cxx_cache_invalidate(at24cxx_cache_t *p_cache)
+{
+    uint16_t i;
+
+    if (p_cache == NULL || !p_cache->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    for (i = 0; i < p_cache->frame_count; i++) {
+        p_cache->p_frames[i].is_valid = false;
+        p_cache->p_frames[i].is_dirty = false;
+        memset(p_cache->p_frames[i].dirty_map, 0, sizeof(p_cache->p_frames[i].dirty_map));
+    }
+
+    p_cache->has_dirty = false;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_cache_get_stats(at24cxx_cache_t *p_cache,
+                                        at24cxx_cache_stats_t *p_stats)
+{
+    uint32_t total;
+
+    if (p_cache == NULL || !p_cache->is_initialized || p_stats == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    *p_stats = p_cache->stats;
+
+    total = p_stats->hit_count + p_stats->miss_count;
+    p_stats->hit_rate_permille = total == 0 ? 0 :
+        (uint16_t)(((uint64_t)p_stats->hit_count * 1000U) / total);
+
+    p_stats->writes_saved = p_stats->logical_write_count > p_stats->page_write_count ?
+                            p_stats->logical_write_count - p_stats->page_write_count : 0;
+
+    return DRV_OK;
+}
+
+/* --- 3. 私有函数实现 (Private Functions) --- */
+
+static driver_status_t static_get_frame(at24cxx_cache_t *p_cache,
+                                        uint16_t page_index,
+                                        at24cxx_cache_frame_t **pp_frame)
+{
+    at24cxx_cache_frame_t *p_frame;
+    at24cxx_cache_frame_t *p_victim;
+    uint16_t i;
+    driver_status_t status;
+
+    p_cache->use_clock++;
+    p_victim = NULL;
+
+    for (i = 0; i < p_cache->frame_count; i++) {
+        p_frame = &p_cache->p_frames[i];
+
+        if (p_frame->is_valid && p_frame->page_index == page_index) {
+            p_frame->last_use = p_cache->use_clock;
+            p_cache->stats.hit_count++;
+            *pp_frame = p_frame;
+            return DRV_OK;
+        }
+
+        /* 优先使用空闲帧, 否则选择最久未使用的帧 */
+        if (p_victim == NULL ||
+            (p_victim->is_valid && (!p_frame->is_valid || p_frame->last_use < p_victim->last_use))) {
+            p_victim = p_frame;
+        }
+    }
+
+    p_cache->stats.miss_count++;
+
+    status = static_flush_frame(p_cache, p_victim);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    p_victim->is_valid = false;
+
+    status = at24cxx_read(p_cache->p_dev,
+                          (uint32_t)page_index * p_cache->page_size,
+                          p_victim->p_data,
+                          p_cache->page_size);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    p_victim->page_index = page_index;
+    p_victim->last_use = p_cache->use_clock;
+    p_victim->is_valid = true;
+    *pp_frame = p_victim;
+
+    return DRV_OK;
+}
+
+static driver_status_t static_flush_frame(at24cxx_cache_t *p_cache,
+                                          at24cxx_cache_frame_t *p_frame)
+{
+    uint16_t first;
+    uint16_t last;
+    uint16_t i;
+    uint32_t programmed;
+    driver_status_t status;
+
+    if (!p_frame->is_valid || !p_frame->is_dirty) {
+        return DRV_OK;
+    }
+
+    first = p_cache->page_size;
+    last = 0;
+    for (i = 0; i < p_cache->page_size; i++) {
+        if (p_frame->dirty_map[i >> 3] & (uint8_t)(1U << (i & 0x07))) {
+            if (first == p_cache->page_size) {
+                first = i;
+            }
+            last = i;
+        }
+    }
+
+    /* 所有修改合并为覆盖首尾脏字节的一次页写入 */
+    programmed = p_cache->p_dev->write_stats.page_write_count;
+    status = at24cxx_write(p_cache->p_dev,
+                           (uint32_t)p_frame->page_index * p_cache->page_size + first,
+                           p_frame->p_data + first,
+                           last - first + 1);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    /* 只统计实际编程的页: 比较模式下内容未变的页不计入 */
+    p_cache->stats.page_write_count += p_cache->p_dev->write_stats.page_write_count - programmed;
+    p_frame->is_dirty = false;
+    memset(p_frame->dirty_map, 0, sizeof(p_frame->dirty_map));
+
+    /* 换出时写回了最后一个脏帧: 周期刷新不再需要唤醒 */
+    for (i = 0; i < p_cache->frame_count; i++) {
+        if (p_cache->p_frames[i].is_dirty) {
+            return DRV_OK;
+        }
+    }
+    p_cache->has_dirty = false;
+
+    return DRV_OK;
+}
+
+static void static_mark_dirty(at24cxx_cache_t *p_cache,
+                              at24cxx_cache_frame_t *p_frame,
+                              uint16_t offset)
+{
+    p_frame->dirty_map[offset >> 3] |= (uint8_t)(1U << (offset & 0x07));
+    p_frame->is_dirty = true;
+
+    if (!p_cache->has_dirty) {
+        p_cache->has_dirty = true;
+        if (p_cache->p_dev->has_time_ops) {
+            p_cache->dirty_since_tick = p_cache->p_dev->time_ops.get_tick();
+        }
+    }
+}
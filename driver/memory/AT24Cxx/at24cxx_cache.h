@@ -0,0 +1,161 @@
+/**
+ * @file at24cxx_cache.h
+ * @brief AT24Cxx 写回式页缓存 (Write-back Page Cache)
+ * @note  缓存帧由调用者分配; 同一页的多次修改在刷新时合并为一次页写入.
+ *        使用缓存后, 不应再绕过缓存直接调用 at24cxx_write() 写同一区域.
+ */
+
+#ifndef AT24CXX_CACHE_H
+#define AT24CXX_CACHE_H
+
+#include "at24cxx_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 数据结构 (Data Structures) --- */
+
+/**
+ * @brief 缓存帧 (对应一个EEPROM页)
+ */
+typedef struct {
+    uint8_t *p_data;          /**< 页数据 (指向调用者提供的缓冲区) */
+    uint16_t page_index;      /**< 缓存的页号 */
+    uint32_t last_use;        /**< LRU时间戳 */
+    bool is_valid;            /**< 帧内数据有效 */
+    bool is_dirty;            /**< 存在未写回的修改 */
+    uint8_t dirty_map[(AT24CXX_MAX_PAGE_SIZE + 7) / 8]; /**< 脏字节位图 */
+} at24cxx_cache_frame_t;
+
+/**
+ * @brief 缓存统计
+ */
+typedef struct {
+    uint32_t hit_count;            /**< 命中次数 (按页访问计) */
+    uint32_t miss_count;           /**< 未命中次数 */
+    uint32_t page_write_count;     /**< 实际页写入次数 (比较模式跳过的页不计入) */
+    uint32_t logical_write_count;  /**< 无缓存时所需的页写入次数 */
+    uint32_t writes_saved;         /**< 节省的页写入次数 */
+    uint16_t hit_rate_permille;    /**< 命中率 (‰) */
+} at24cxx_cache_stats_t;
+
+/**
+ * @brief 缓存对象
+ */
+typedef struct {
+    at24cxx_dev_t *p_dev;                /**< 底层EEPROM设备 */
+    at24cxx_cache_frame_t *p_frames;     /**< 缓存帧数组 */
+    uint16_t frame_count;                /**< 缓存帧数量 */
+    uint16_t page_size;                  /**< 页大小 */
+    uint32_t use_clock;                  /**< LRU计数器 */
+    uint32_t flush_interval_ms;          /**< 周期刷新间隔 (0: 仅手动刷新) */
+    uint32_t dirty_since_tick;           /**< 最早一次未刷新修改的Tick */
+    bool has_dirty;                      /**< 是否存在脏帧 */
+    at24cxx_cache_stats_t stats;         /**< 统计信息 */
+    bool is_initialized;                 /**< 初始化标志 */
+} at24cxx_cache_t;
+
+/* --- 2. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 初始化缓存
+ * @param p_cache 缓存对象指针
+ * @param p_dev 已初始化的EEPROM设备
+ * @param p_frames 缓存帧数组 (frame_count 个)
+ * @param p_frame_buf 帧数据缓冲区 (frame_count * page_size 字节)
+ * @param frame_count 缓存帧数量
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_cache_init(at24cxx_cache_t *p_cache,
+                                   at24cxx_dev_t *p_dev,
+                                   at24cxx_cache_frame_t *p_frames,
+                                   uint8_t *p_frame_buf,
+                                   uint16_t frame_count);
+
+/**
+ * @brief 通过缓存读取数据 (未命中时整页读入)
+ * @param p_cache 缓存对象指针
+ * @param address 起始地址
+ * @param p_data 读取数据缓冲区
+ * @param length 读取长度 (bytes)
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_cache_read(at24cxx_cache_t *p_cache,
+                                   uint32_t address,
+                                   uint8_t *p_data,
+                                   uint32_t length);
+
+/**
+ * @brief 通过缓存写入数据 (仅修改RAM, 刷新时写回)
+ * @param p_cache 缓存对象指针
+ * @param address 起始地址
+ * @param p_data 写入数据缓冲区
+ * @param length 写入长度 (bytes)
+ * @return driver_status_t
+ * @note  与缓存内容相同的字节不标记为脏
+ */
+driver_status_t at24cxx_cache_write(at24cxx_cache_t *p_cache,
+                                    uint32_t address,
+                                    const uint8_t *p_data,
+                                    uint32_t length);
+
+/**
+ * @brief 通过缓存读取单个字节
+ */
+driver_status_t at24cxx_cache_read_byte(at24cxx_cache_t *p_cache,
+                                        uint32_t address,
+                                        uint8_t *p_data);
+
+/**
+ * @brief 通过缓存写入单个字节
+ */
+driver_status_t at24cxx_cache_write_byte(at24cxx_cache_t *p_cache,
+                                         uint32_t address,
+                                         uint8_t data);
+
+/**
+ * @brief 刷新所有脏帧 (每个脏页一次页写入)
+ * @param p_cache 缓存对象指针
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_cache_flush(at24cxx_cache_t *p_cache);
+
+/**
+ * @brief 设置周期刷新间隔
+ * @param p_cache 缓存对象指针
+ * @param interval_ms 最早一次修改后经过该时间即刷新 (0: 关闭)
+ * @return driver_status_t
+ * @note  需要底层设备已通过 at24cxx_set_time_ops() 注入时间接口
+ */
+driver_status_t at24cxx_cache_set_flush_interval(at24cxx_cache_t *p_cache,
+                                                 uint32_t interval_ms);
+
+/**
+ * @brief 周期任务: 到达刷新间隔时刷新缓存
+ * @param p_cache 缓存对象指针
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_cache_poll(at24cxx_cache_t *p_cache);
+
+/**
+ * @brief 丢弃所有缓存内容 (不写回)
+ * @param p_cache 缓存对象指针
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_cache_invalidate(at24cxx_cache_t *p_cache);
+
+/**
+ * @brief 获取缓存统计
+ * @param p_cache 缓存对象指针
+ * @param p_stats 输出统计信息
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_cache_get_stats(at24cxx_cache_t *p_cache,
+                                        at24cxx_cache_stats_t *p_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT24CXX_CACHE_H */
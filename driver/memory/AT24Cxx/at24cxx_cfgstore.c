@@ -0,0 +1,249 @@
+#include "at24cxx_cfgstore.h"
+#include "../../../core/driver_crc.h"
+#include <string.h>
+
+/* --- 1. 私有宏定义 (Private Macros) --- */
+
+/*
+ * 槽头部布局 (12 字节, 位于槽起始处):
+ * [0..1] 魔数  [2..5] 代数(大端)  [6..7] 数据长度  [8..9] 数据CRC
+ * [10..11] 头部CRC (覆盖前10字节)
+ * 数据从 data_offset 开始, 与头部不共享页, 写头部不会破坏数据.
+ */
+#define CFG_MAGIC_0             0xC5U
+#define CFG_MAGIC_1             0x3AU
+#define CFG_OFFSET_GENERATION   2
+#define CFG_OFFSET_LENGTH       6
+#define CFG_OFFSET_DATA_CRC     8
+#define CFG_OFFSET_HEADER_CRC   10
+
+/* 代数比较 (允许回绕): a 比 b 新 */
+#define CFG_GEN_NEWER(a, b)     ((int32_t)((uint32_t)(a) - (uint32_t)(b)) > 0)
+
+/* --- 2. 私有函数声明 (Private Functions) --- */
+
+static uint32_t static_slot_address(const at24cxx_cfgstore_t *p_store, uint8_t slot);
+static driver_status_t static_read_header(at24cxx_cfgstore_t *p_store, uint8_t slot);
+static void static_select_active(at24cxx_cfgstore_t *p_store);
+
+/* --- 3. 公共函数实现 (Public Functions) --- */
+
+driver_status_t at24cxx_cfgstore_init(at24cxx_cfgstore_t *p_store,
+                                      at24cxx_dev_t *p_dev,
+                                      const at24cxx_cfgstore_config_t *p_config)
+{
+    uint16_t page_size;
+    uint8_t slot;
+    driver_status_t status;
+
+    if (p_store == NULL || p_dev == NULL || !p_dev->is_initialized || p_config == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    page_size = p_dev->config.page_size;
+
+    if ((p_config->base_address % page_size) != 0 || p_config->slot_size == 0 ||
+        (p_config->slot_size % page_size) != 0 ||
+        p_config->base_address >= p_dev->config.capacity ||
+        2UL * p_config->slot_size > p_dev->config.capacity - p_config->base_address) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    memset(p_store, 0, sizeof(at24cxx_cfgstore_t));
+
+    p_store->p_dev = p_dev;
+    p_store->config = *p_config;
+
+    /* 头部独占整页 (页大小小于头部时占用多页) */
+    p_store->data_offset = (uint16_t)(((AT24CXX_CFGSTORE_HEADER_SIZE + page_size - 1) / page_size) *
+                                      page_size);
+    if (p_store->data_offset >= p_config->slot_size) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    for (slot = 0; slot < 2; slot++) {
+        status = static_read_header(p_store, slot);
+        if (status != DRV_OK) {
+            return status;
+        }
+    }
+
+    static_select_active(p_store);
+
+    p_store->is_initialized = true;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_cfgstore_load(at24cxx_cfgstore_t *p_store,
+                                      uint8_t *p_data,
+                                      uint16_t buf_size,
+                                      uint16_t *p_length)
+{
+    at24cxx_cfgstore_header_t *p_header;
+    driver_status_t status;
+
+    if (p_store == NULL || !p_store->is_initialized || p_data == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    while (p_store->active_slot != AT24CXX_CFGSTORE_NO_SLOT) {
+        p_header = &p_store->headers[p_store->active_slot];
+
+        if (p_header->length > buf_size) {
+            return DRV_ERR_NO_MEM;
+        }
+
+        status = at24cxx_read(p_store->p_dev,
+                              static_slot_address(p_store, p_store->active_slot) + p_store->data_offset,
+                              p_data, p_header->length);
+        if (status != DRV_OK) {
+            return status;
+        }
+
+        if (driver_crc16_ccitt(p_data, p_header->length) == p_header->data_crc) {
+            if (p_length != NULL) {
+                *p_length = p_header->length;
+            }
+            return DRV_OK;
+        }
+
+        /* 数据损坏: 放弃该槽, 回退到另一个槽 */
+        p_header->is_valid = false;
+        static_select_active(p_store);
+    }
+
+    return DRV_ERR_COMMON;
+}
+
+driver_status_t at24cxx_cfgstore_save(at24cxx_cfgstore_t *p_store,
+                                      const uint8_t *p_data,
+                                      uint16_t length)
+{
+    uint8_t header[AT24CXX_CFGSTORE_HEADER_SIZE];
+    uint8_t target;
+    uint32_t address;
+    uint16_t crc;
+    uint32_t generation;
+    driver_status_t status;
+
+    if (p_store == NULL || !p_store->is_initialized || p_data == NULL || length == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (length > p_store->config.slot_size - p_store->data_offset) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_store->active_slot == AT24CXX_CFGSTORE_NO_SLOT) {
+        target = 0;
+        generation = 1;
+    } else {
+        target = (uint8_t)(p_store->active_slot ^ 1U);
+        generation = p_store->headers[p_store->active_slot].generation + 1U;
+    }
+
+    address = static_slot_address(p_store, target);
+
+    /* 1. 数据先写入非活动槽; 此时该槽头部仍指向旧内容或无效 */
+    p_store->headers[target].is_valid = false;
+
+    status = at24cxx_write(p_store->p_dev, address + p_store->data_offset, p_data, length);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    /* 2. 最后写入头部, 头部写完整之前活动槽不变 */
+    crc = driver_crc16_ccitt(p_data, length);
+
+    header[0] = CFG_MAGIC_0;
+    header[1] = CFG_MAGIC_1;
+    header[CFG_OFFSET_GENERATION] = DRV_U32_BYTE0(generation);
+    header[CFG_OFFSET_GENERATION + 1] = DRV_U32_BYTE1(generation);
+    header[CFG_OFFSET_GENERATION + 2] = DRV_U32_BYTE2(generation);
+    header[CFG_OFFSET_GENERATION + 3] = DRV_U32_BYTE3(generation);
+    header[CFG_OFFSET_LENGTH] = DRV_U16_HIGH(length);
+    header[CFG_OFFSET_LENGTH + 1] = DRV_U16_LOW(length);
+    header[CFG_OFFSET_DATA_CRC] = DRV_U16_HIGH(crc);
+    header[CFG_OFFSET_DATA_CRC + 1] = DRV_U16_LOW(crc);
+
+    driver_crc16_ccitt_append(header, CFG_OFFSET_HEADER_CRC);
+
+    status = at24cxx_write(p_store->p_dev, address, header, sizeof(header));
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    p_store->headers[target].generation = generation;
+    p_store->headers[target].length = length;
+    p_store->headers[target].data_crc = DRV_MAKE_U16(header[CFG_OFFSET_DATA_CRC],
+                                                     header[CFG_OFFSET_DATA_CRC + 1]);
+    p_store->headers[target].is_valid = true;
+    p_store->active_slot = target;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_cfgstore_get_generation(at24cxx_cfgstore_t *p_store,
+                                                uint32_t *p_generation)
+{
+    if (p_store == NULL || !p_store->is_initialized || p_generation == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_store->active_slot == AT24CXX_CFGSTORE_NO_SLOT) {
+        return DRV_ERR_COMMON;
+    }
+
+    *p_generation = p_store->headers[p_store->active_slot].generation;
+
+    return DRV_OK;
+}
+
+/* --- 4. 私有函数实现 (Private Functions) --- */
+
+static uint32_t static_slot_address(const at24cxx_cfgstore_t *p_store, uint8_t slot)
+{
+    return p_store->config.base_address + (uint32_t)slot * p_store->config.slot_size;
+}
+
+static driver_status_t static_read_header(at24cxx_cfgstore_t *p_store, uint8_t slot)
+{
+    uint8_t header[AT24CXX_CFGSTORE_HEADER_SIZE];
+    at24cxx_cfgstore_header_t *p_header = &p_store->headers[slot];
+    driver_status_t status;
+
+    status = at24cxx_read(p_store->p_dev, static_slot_address(p_store, slot), header, sizeof(header));
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    p_header->generation = DRV_MAKE_U32(header[CFG_OFFSET_GENERATION], header[CFG_OFFSET_GENERATION + 1],
+                                        header[CFG_OFFSET_GENERATION + 2], header[CFG_OFFSET_GENERATION + 3]);
+    p_header->length = DRV_MAKE_U16(header[CFG_OFFSET_LENGTH], header[CFG_OFFSET_LENGTH + 1]);
+    p_header->data_crc = DRV_MAKE_U16(header[CFG_OFFSET_DATA_CRC], header[CFG_OFFSET_DATA_CRC + 1]);
+
+    p_header->is_valid = header[0] == CFG_MAGIC_0 && header[1] == CFG_MAGIC_1 &&
+                         driver_crc16_ccitt_check(header, CFG_OFFSET_HEADER_CRC) &&
+                         p_header->length != 0 &&
+                         p_header->length <= p_store->config.slot_size - p_store->data_offset;
+
+    return DRV_OK;
+}
+
+static void static_select_active(at24cxx_cfgstore_t *p_store)
+{
+    bool valid_a = p_store->headers[0].is_valid;
+    bool valid_b = p_store->headers[1].is_valid;
+
+    if (valid_a && valid_b) {
+        p_store->active_slot = CFG_GEN_NEWER(p_store->headers[1].generation,
+                                             p_store->headers[0].generation) ? 1 : 0;
+    } else if (valid_a) {
+        p_store->active_slot = 0;
+    } else if (valid_b) {
+        p_store->active_slot = 1;
+    } else {
+        p_store->active_slot = AT24CXX_CFGSTORE_NO_SLOT;
+    }
+}
@@ -0,0 +1,110 @@
+/**
+ * @file at24cxx_cfgstore.h
+ * @brief AT24Cxx A/B 双槽配置存储 (Double-buffered Config Store)
+ * @note  配置块在两个槽之间交替写入: 先写非活动槽的数据, 最后写其头部.
+ *        头部包含代数计数与数据CRC, 写入过程中掉电时另一个槽保持完整.
+ *        上电加载只需每个槽一次头部读取加一次数据批量读取.
+ */
+
+#ifndef AT24CXX_CFGSTORE_H
+#define AT24CXX_CFGSTORE_H
+
+#include "at24cxx_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#define AT24CXX_CFGSTORE_HEADER_SIZE  12U     /**< 槽头部大小 */
+#define AT24CXX_CFGSTORE_NO_SLOT      0xFFU   /**< 无有效槽 */
+
+/* --- 2. 配置与对象 (Configuration & Object) --- */
+
+/**
+ * @brief 配置存储参数
+ * @note  槽A位于 base_address, 槽B紧随其后; 每个槽的头部独占页对齐的区域
+ */
+typedef struct {
+    uint32_t base_address;   /**< 存储区起始地址 (页对齐) */
+    uint16_t slot_size;      /**< 单个槽大小 (页大小的整数倍, 含头部区域) */
+} at24cxx_cfgstore_config_t;
+
+/**
+ * @brief 槽头部信息 (RAM副本)
+ */
+typedef struct {
+    uint32_t generation;     /**< 代数, 每次保存加1 */
+    uint16_t length;         /**< 数据长度 */
+    uint16_t data_crc;       /**< 数据CRC */
+    bool is_valid;           /**< 头部校验通过 */
+} at24cxx_cfgstore_header_t;
+
+/**
+ * @brief 配置存储对象
+ */
+typedef struct {
+    at24cxx_dev_t *p_dev;                       /**< 底层EEPROM设备 */
+    at24cxx_cfgstore_config_t config;           /**< 配置副本 */
+    uint16_t data_offset;                       /**< 数据在槽内的偏移 (头部区域大小) */
+    uint8_t active_slot;                        /**< 当前活动槽 (0/1, 或 AT24CXX_CFGSTORE_NO_SLOT) */
+    at24cxx_cfgstore_header_t headers[2];       /**< 两个槽的头部 */
+    bool is_initialized;                        /**< 初始化标志 */
+} at24cxx_cfgstore_t;
+
+/* --- 3. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 初始化配置存储: 读取两个槽的头部并选出最新的有效槽
+ * @param p_store 配置存储对象指针
+ * @param p_dev 已初始化的EEPROM设备
+ * @param p_config 存储参数
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_cfgstore_init(at24cxx_cfgstore_t *p_store,
+                                      at24cxx_dev_t *p_dev,
+                                      const at24cxx_cfgstore_config_t *p_config);
+
+/**
+ * @brief 加载配置 (一次批量读取活动槽的数据)
+ * @param p_store 配置存储对象指针
+ * @param p_data 输出缓冲区
+ * @param buf_size 缓冲区大小
+ * @param p_length 输出数据长度 (可为NULL)
+ * @return driver_status_t
+ * @retval DRV_ERR_COMMON 两个槽均无有效配置
+ * @retval DRV_ERR_NO_MEM 缓冲区不足
+ * @note  活动槽数据CRC错误时自动回退到另一个槽
+ */
+driver_status_t at24cxx_cfgstore_load(at24cxx_cfgstore_t *p_store,
+                                      uint8_t *p_data,
+                                      uint16_t buf_size,
+                                      uint16_t *p_length);
+
+/**
+ * @brief 保存配置到非活动槽, 完成后切换活动槽
+ * @param p_store 配置存储对象指针
+ * @param p_data 配置数据
+ * @param length 数据长度 (不超过 slot_size - 头部区域)
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_cfgstore_save(at24cxx_cfgstore_t *p_store,
+                                      const uint8_t *p_data,
+                                      uint16_t length);
+
+/**
+ * @brief 获取当前配置的代数
+ * @param p_store 配置存储对象指针
+ * @param p_generation 输出代数
+ * @return driver_status_t
+ * @retval DRV_ERR_COMMON 无有效配置
+ */
+driver_status_t at24cxx_cfgstore_get_generation(at24cxx_cfgstore_t *p_store,
+                                                uint32_t *p_generation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT24CXX_CFGSTORE_H */
@@ -1,16 +1,53 @@
 #include "at24cxx_driver.h"
+#include "../../../core/driver_crc.h"
 #include <string.h>
 #include <stdlib.h>
 
-/* --- 1. 私有函数声明 (Private Functions) --- */
+/* --- 1. 私有宏定义 (Private Macros) --- */
 
+#define AT24CXX_DEFAULT_POLL_INTERVAL_US   200U
+#define AT24CXX_MAX_BLOCK_COUNT            8U      /**< 设备地址中最多3个块选择位 */
+
+/* --- 2. 私有函数声明 (Private Functions) --- */
+
+static driver_status_t static_poll_ack(at24cxx_dev_t *p_dev);
 static driver_status_t static_wait_write_complete(at24cxx_dev_t *p_dev);
+static void static_update_twr_stats(at24cxx_dev_t *p_dev, uint32_t twr_us);
+static uint8_t static_dev_addr(at24cxx_dev_t *p_dev, uint32_t address);
+static bool static_range_valid(at24cxx_dev_t *p_dev, uint32_t address, uint32_t length);
+static driver_status_t static_read_block(at24cxx_dev_t *p_dev,
+                                         uint32_t address,
+                                         uint8_t *p_data,
+                                         uint32_t length);
+static driver_status_t static_send_page(at24cxx_dev_t *p_dev,
+                                        uint32_t address,
+                                        const uint8_t *p_data,
+                                        uint16_t length,
+                                        bool use_async);
 static driver_status_t static_write_page(at24cxx_dev_t *p_dev,
-                                         uint16_t address,
+                                         uint32_t address,
                                          const uint8_t *p_data,
                                          uint16_t length);
-
-/* --- 2. 公共函数实现 (Public Functions) --- */
+static driver_status_t static_write_page_changed(at24cxx_dev_t *p_dev,
+                                                 uint32_t address,
+                                                 const uint8_t *p_data,
+                                                 uint16_t length);
+static uint16_t static_page_chunk(at24cxx_dev_t *p_dev,
+                                  uint32_t address,
+                                  uint32_t remaining);
+static driver_status_t static_send_erase_page(at24cxx_dev_t *p_dev,
+                                              uint32_t address,
+                                              uint16_t length);
+static driver_status_t static_erase_transfer(at24cxx_dev_t *p_dev,
+                                             bool write_pending,
+                                             uint32_t address,
+                                             uint16_t length,
+                                             uint8_t *p_read_buf);
+static driver_status_t static_job_send_next(at24cxx_dev_t *p_dev);
+static driver_status_t static_job_finish(at24cxx_dev_t *p_dev, driver_status_t result);
+static void static_async_page_sent(void *user_data, driver_status_t status);
+
+/* --- 3. 公共函数实现 (Public Functions) --- */
 
 driver_status_t at24cxx_init(at24cxx_dev_t *p_dev,
                              const driver_i2c_ops_t *p_i2c_ops,
@@ -36,11 +73,50 @@ driver_status_t at24cxx_init(at24cxx_dev_t *p_dev,
         p_dev->config = AT24CXX_GET_DEFAULT_CONFIG(AT24CXX_MODEL_128);
     }
 
+    if (p_dev->config.page_size == 0 || p_dev->config.page_size > AT24CXX_MAX_PAGE_SIZE) {
+        p_dev->is_initialized = false;
+        return DRV_ERR_NOT_SUPPORT;
+    }
+
+    /* 地址字节之外的高位放入设备地址的块选择位, 最多 3 位 */
+    if ((p_dev->config.addr_bytes != 1 && p_dev->config.addr_bytes != 2) ||
+        p_dev->config.capacity == 0 ||
+        (p_dev->config.capacity >> (8U * p_dev->config.addr_bytes)) > AT24CXX_MAX_BLOCK_COUNT) {
+        p_dev->is_initialized = false;
+        return DRV_ERR_NOT_SUPPORT;
+    }
+
+    if (p_dev->config.poll_interval_us == 0) {
+        p_dev->config.poll_interval_us = AT24CXX_DEFAULT_POLL_INTERVAL_US;
+    }
+
     p_dev->is_initialized = true;
 
     return DRV_OK;
 }
 
+driver_status_t at24cxx_set_time_ops(at24cxx_dev_t *p_dev,
+                                     const driver_time_ops_t *p_time_ops)
+{
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_time_ops == NULL) {
+        p_dev->has_time_ops = false;
+        return DRV_OK;
+    }
+
+    if (p_time_ops->get_tick == NULL || p_time_ops->delay_us == NULL) {
+        return DRV_ERR_NOT_SUPPORT;
+    }
+
+    p_dev->time_ops = *p_time_ops;
+    p_dev->has_time_ops = true;
+
+    return DRV_OK;
+}
+
 driver_status_t at24cxx_probe(at24cxx_dev_t *p_dev)
 {
     uint8_t dummy;
@@ -67,13 +143,13 @@ driver_status_t at24cxx_probe(at24cxx_dev_t *p_dev)
 }
 
 driver_status_t at24cxx_read(at24cxx_dev_t *p_dev,
-                             uint16_t address,
+                             uint32_t address,
                              uint8_t *p_data,
-                             uint16_t length)
+                             uint32_t length)
 {
-    uint8_t addr_buf[2];
-    uint8_t addr_len;
-    uint8_t dev_addr_7bit;
+    uint32_t block_size;
+    uint32_t chunk;
+    uint32_t done;
     driver_status_t status;
 
     if (p_dev == NULL || !p_dev->is_initialized) {
@@ -88,52 +164,106 @@ driver_status_t at24cxx_read(at24cxx_dev_t *p_dev,
         return DRV_ERR_INVALID_VAL;
     }
 
-    if (address + length > p_dev->config.capacity) {
+    if (!static_range_valid(p_dev, address, length)) {
         return DRV_ERR_INVALID_VAL;
     }
 
-    dev_addr_7bit = p_dev->config.device_addr >> 1;
-    addr_len = p_dev->config.addr_bytes;
+    /* 写周期内芯片不应答, 读取必须等待非阻塞写入完成 */
+    if (p_dev->write_job.state != AT24CXX_WRITE_STATE_IDLE) {
+        return DRV_ERR_BUSY;
+    }
 
-    if (addr_len == 1) {
-        status = p_dev->i2c_ops.read_reg(p_dev->i2c_user_data,
-                                          dev_addr_7bit,
-                                          (uint8_t)address,
-                                          p_data,
-                                          length);
-    } else {
-        addr_buf[0] = (uint8_t)(address >> 8);
-        addr_buf[1] = (uint8_t)address;
+    /* 块选择位在设备地址中, 连续读取只能在同一块内进行 */
+    block_size = 1UL << (8U * p_dev->config.addr_bytes);
+    done = 0;
 
-        status = p_dev->i2c_ops.write_reg(p_dev->i2c_user_data,
-                                           dev_addr_7bit,
-                                           addr_buf[0],
-                                           &addr_buf[1],
-                                           1);
+    while (done < length) {
+        chunk = block_size - ((address + done) & (block_size - 1U));
+        if (chunk > length - done) {
+            chunk = length - done;
+        }
 
+        status = static_read_block(p_dev, address + done, p_data + done, chunk);
         if (status != DRV_OK) {
             return status;
         }
 
-        status = p_dev->i2c_ops.read_reg(p_dev->i2c_user_data,
-                                          dev_addr_7bit,
-                                          addr_buf[1],
-                                          p_data,
-                                          length);
+        done += chunk;
     }
 
-    return status;
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_read_async(at24cxx_dev_t *p_dev,
+                                   uint32_t address,
+                                   uint8_t *p_data,
+                                   uint32_t length,
+                                   driver_completion_callback_t cb,
+                                   void *user_data)
+{
+    uint32_t block_size;
+
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_data == NULL || length == 0 || cb == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (!static_range_valid(p_dev, address, length)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    block_size = 1UL << (8U * p_dev->config.addr_bytes);
+    if ((address & (block_size - 1U)) + length > block_size) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_dev->write_job.state != AT24CXX_WRITE_STATE_IDLE) {
+        return DRV_ERR_BUSY;
+    }
+
+    if (p_dev->i2c_ops.write_read_async != NULL) {
+        if (p_dev->config.addr_bytes == 1) {
+            p_dev->rx_addr_buf[0] = (uint8_t)address;
+        } else {
+            p_dev->rx_addr_buf[0] = (uint8_t)(address >> 8);
+            p_dev->rx_addr_buf[1] = (uint8_t)address;
+        }
+
+        return p_dev->i2c_ops.write_read_async(p_dev->i2c_user_data,
+                                               static_dev_addr(p_dev, address),
+                                               p_dev->rx_addr_buf,
+                                               p_dev->config.addr_bytes,
+                                               p_data,
+                                               length,
+                                               cb,
+                                               user_data);
+    }
+
+    /* 2字节地址无法通过 read_reg_async 的单字节寄存器地址发送 */
+    if (p_dev->config.addr_bytes == 1 && p_dev->i2c_ops.read_reg_async != NULL) {
+        return p_dev->i2c_ops.read_reg_async(p_dev->i2c_user_data,
+                                             static_dev_addr(p_dev, address),
+                                             (uint8_t)address,
+                                             p_data,
+                                             length,
+                                             cb,
+                                             user_data);
+    }
+
+    return DRV_ERR_NOT_SUPPORT;
 }
 
 driver_status_t at24cxx_write(at24cxx_dev_t *p_dev,
-                              uint16_t address,
+                              uint32_t address,
                               const uint8_t *p_data,
-                              uint16_t length)
+                              uint32_t length)
 {
-    uint16_t bytes_written;
+    uint32_t bytes_written;
     uint16_t bytes_to_write;
-    uint16_t page_space;
-    uint16_t current_addr;
+    uint32_t current_addr;
     driver_status_t status;
 
     if (p_dev == NULL || !p_dev->is_initialized) {
@@ -148,20 +278,27 @@ driver_status_t at24cxx_write(at24cxx_dev_t *p_dev,
         return DRV_ERR_INVALID_VAL;
     }
 
-    if (address + length > p_dev->config.capacity) {
+    if (!static_range_valid(p_dev, address, length)) {
         return DRV_ERR_INVALID_VAL;
     }
 
+    if (p_dev->write_job.state != AT24CXX_WRITE_STATE_IDLE) {
+        return DRV_ERR_BUSY;
+    }
+
     bytes_written = 0;
     current_addr = address;
 
     while (bytes_written < length) {
-        page_space = p_dev->config.page_size - (current_addr % p_dev->config.page_size);
-        bytes_to_write = (length - bytes_written) < page_space ?
-                         (length - bytes_written) : page_space;
-
-        status = static_write_page(p_dev, current_addr,
-                                   p_data + bytes_written, bytes_to_write);
+        bytes_to_write = static_page_chunk(p_dev, current_addr, length - bytes_written);
+
+        if (p_dev->config.write_mode == AT24CXX_WRITE_MODE_COMPARE) {
+            status = static_write_page_changed(p_dev, current_addr,
+                                               p_data + bytes_written, bytes_to_write);
+        } else {
+            status = static_write_page(p_dev, current_addr,
+                                       p_data + bytes_written, bytes_to_write);
+        }
 
         if (status != DRV_OK) {
             return status;
@@ -174,12 +311,169 @@ driver_status_t at24cxx_write(at24cxx_dev_t *p_dev,
     return DRV_OK;
 }
 
+driver_status_t at24cxx_write_begin(at24cxx_dev_t *p_dev,
+                                    uint32_t address,
+                                    const uint8_t *p_data,
+                                    uint32_t length,
+                                    driver_completion_callback_t cb,
+                                    void *user_data)
+{
+    at24cxx_write_job_t *p_job;
+    driver_status_t status;
+
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_data == NULL || length == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_dev->i2c_ops.write_reg == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (!static_range_valid(p_dev, address, length)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_job = &p_dev->write_job;
+
+    if (p_job->state != AT24CXX_WRITE_STATE_IDLE) {
+        return DRV_ERR_BUSY;
+    }
+
+    p_job->p_data = p_data;
+    p_job->address = address;
+    p_job->length = length;
+    p_job->offset = 0;
+    p_job->cb = cb;
+    p_job->user_data = user_data;
+    p_job->result = DRV_ERR_BUSY;
+
+    status = static_job_send_next(p_dev);
+    if (status != DRV_OK) {
+        p_job->state = AT24CXX_WRITE_STATE_IDLE;
+        p_job->result = status;
+    }
+
+    return status;
+}
+
+driver_status_t at24cxx_write_step(at24cxx_dev_t *p_dev)
+{
+    at24cxx_write_job_t *p_job;
+    driver_status_t status;
+    uint32_t elapsed_ms;
+    uint32_t now_tick;
+
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_job = &p_dev->write_job;
+
+    switch (p_job->state) {
+    case AT24CXX_WRITE_STATE_IDLE:
+        return DRV_OK;
+
+    case AT24CXX_WRITE_STATE_SENDING:
+        return DRV_ERR_BUSY;
+
+    case AT24CXX_WRITE_STATE_WRITE_CYCLE:
+        break;
+
+    default:
+        return static_job_finish(p_dev, DRV_ERR_COMMON);
+    }
+
+    if (p_job->bus_status != DRV_OK) {
+        return static_job_finish(p_dev, p_job->bus_status);
+    }
+
+    if (p_dev->has_time_ops) {
+        /* 未到预计的写周期结束时间前不占用总线 */
+        elapsed_ms = p_dev->time_ops.get_tick() - p_job->cycle_start_tick;
+        if (elapsed_ms * 1000U + p_dev->config.poll_interval_us < p_dev->write_stats.estimate_twr_us) {
+            return DRV_ERR_BUSY;
+        }
+    }
+
+    p_job->poll_attempts++;
+
+    status = static_poll_ack(p_dev);
+    if (status != DRV_OK) {
+        if (p_dev->has_time_ops) {
+            p_job->last_nack_tick = p_dev->time_ops.get_tick();
+            elapsed_ms = p_job->last_nack_tick - p_job->cycle_start_tick;
+            if (elapsed_ms > p_dev->config.write_timeout_ms) {
+                return static_job_finish(p_dev, DRV_ERR_TIMEOUT);
+            }
+        } else if (p_job->poll_attempts >= p_dev->config.write_timeout_ms) {
+            return static_job_finish(p_dev, DRV_ERR_TIMEOUT);
+        }
+
+        return DRV_ERR_BUSY;
+    }
+
+    /*
+     * 与阻塞路径一样更新 tWR 统计 (分辨率为 get_tick 的 1ms).
+     * 只有上一次未应答的轮询在 1 个 Tick 之内时, 应答时刻才接近写周期结束时刻;
+     * 调用间隔较大 (如条带卷中其他芯片占用总线) 时应答时刻只是上界,
+     * 计入统计会使估计值逐次抬高, 不更新.
+     */
+    if (p_dev->has_time_ops && p_job->poll_attempts > 1) {
+        now_tick = p_dev->time_ops.get_tick();
+        if (now_tick - p_job->last_nack_tick <= 1U) {
+            static_update_twr_stats(p_dev, (now_tick - p_job->cycle_start_tick) * 1000U);
+        }
+    }
+
+    p_dev->write_stats.page_write_count++;
+    p_job->offset += p_job->chunk_len;
+
+    if (p_job->offset >= p_job->length) {
+        return static_job_finish(p_dev, DRV_OK);
+    }
+
+    status = static_job_send_next(p_dev);
+    if (status != DRV_OK) {
+        return static_job_finish(p_dev, status);
+    }
+
+    return DRV_ERR_BUSY;
+}
+
+driver_status_t at24cxx_write_poll(at24cxx_dev_t *p_dev)
+{
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_dev->write_job.state != AT24CXX_WRITE_STATE_IDLE) {
+        return DRV_ERR_BUSY;
+    }
+
+    return p_dev->write_job.result;
+}
+
 driver_status_t at24cxx_erase(at24cxx_dev_t *p_dev,
-                              uint16_t address,
-                              uint16_t length)
+                              uint32_t address,
+                              uint32_t length)
+{
+    return at24cxx_erase_range(p_dev, address, length, false);
+}
+
+driver_status_t at24cxx_erase_range(at24cxx_dev_t *p_dev,
+                                    uint32_t address,
+                                    uint32_t length,
+                                    bool skip_erased)
 {
-    uint8_t *p_erase_buf;
+    uint8_t read_buf[AT24CXX_MAX_PAGE_SIZE];
+    uint32_t done;
+    uint16_t chunk;
     uint16_t i;
+    bool write_pending;
     driver_status_t status;
 
     if (p_dev == NULL || !p_dev->is_initialized) {
@@ -190,47 +484,88 @@ driver_status_t at24cxx_erase(at24cxx_dev_t *p_dev,
         return DRV_ERR_INVALID_VAL;
     }
 
-    if (address + length > p_dev->config.capacity) {
+    if (!static_range_valid(p_dev, address, length)) {
         return DRV_ERR_INVALID_VAL;
     }
 
-    p_erase_buf = (uint8_t *)malloc(length);
-    if (p_erase_buf == NULL) {
-        return DRV_ERR_NO_MEM;
+    if (p_dev->write_job.state != AT24CXX_WRITE_STATE_IDLE) {
+        return DRV_ERR_BUSY;
+    }
+
+    /* 发送缓冲区的数据部分只填充一次 0xFF, 每页只改写其前导的低地址字节 */
+    memset(&p_dev->tx_buf[1], 0xFF, p_dev->config.page_size);
+
+    write_pending = false;
+    done = 0;
+
+    while (done < length) {
+        chunk = static_page_chunk(p_dev, address + done, length - done);
+
+        if (skip_erased) {
+            status = static_erase_transfer(p_dev, write_pending, address + done, chunk, read_buf);
+            if (status != DRV_OK) {
+                return status;
+            }
+            write_pending = false;
+
+            for (i = 0; i < chunk && read_buf[i] == 0xFF; i++) {
+            }
+
+            if (i == chunk) {
+                p_dev->write_stats.skipped_page_count++;
+                p_dev->write_stats.skipped_byte_count += chunk;
+                done += chunk;
+                continue;
+            }
+        }
+
+        status = static_erase_transfer(p_dev, write_pending, address + done, chunk, NULL);
+        if (status != DRV_OK) {
+            return status;
+        }
+
+        p_dev->write_stats.page_write_count++;
+        write_pending = true;
+        done += chunk;
     }
 
-    for (i = 0; i < length; i++) {
-        p_erase_buf[i] = 0xFF;
+    if (write_pending) {
+        return static_wait_write_complete(p_dev);
     }
 
-    status = at24cxx_write(p_dev, address, p_erase_buf, length);
+    return DRV_OK;
+}
 
-    free(p_erase_buf);
+driver_status_t at24cxx_erase_chip(at24cxx_dev_t *p_dev, bool skip_erased)
+{
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
 
-    return status;
+    return at24cxx_erase_range(p_dev, 0, p_dev->config.capacity, skip_erased);
 }
 
 driver_status_t at24cxx_read_byte(at24cxx_dev_t *p_dev,
-                                  uint16_t address,
+                                  uint32_t address,
                                   uint8_t *p_data)
 {
     return at24cxx_read(p_dev, address, p_data, 1);
 }
 
 driver_status_t at24cxx_write_byte(at24cxx_dev_t *p_dev,
-                                   uint16_t address,
+                                   uint32_t address,
                                    uint8_t data)
 {
     return at24cxx_write(p_dev, address, &data, 1);
 }
 
 driver_status_t at24cxx_verify(at24cxx_dev_t *p_dev,
-                               uint16_t address,
+                               uint32_t address,
                                const uint8_t *p_data,
-                               uint16_t length)
+                               uint32_t length)
 {
     uint8_t *p_read_buf;
-    uint16_t i;
+    uint32_t i;
     driver_status_t status;
 
     if (p_dev == NULL || !p_dev->is_initialized) {
@@ -262,6 +597,145 @@ driver_status_t at24cxx_verify(at24cxx_dev_t *p_dev,
     return status;
 }
 
+driver_status_t at24cxx_write_with_crc(at24cxx_dev_t *p_dev,
+                                       uint32_t address,
+                                       const uint8_t *p_data,
+                                       uint32_t length)
+{
+    uint8_t tail_buf[AT24CXX_MAX_PAGE_SIZE + AT24CXX_CRC_SIZE];
+    uint32_t head_len;
+    uint32_t tail_len;
+    uint16_t crc;
+    driver_status_t status;
+
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_data == NULL || length == 0 || length > UINT32_MAX - AT24CXX_CRC_SIZE) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (!static_range_valid(p_dev, address, length + AT24CXX_CRC_SIZE)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    /* 数据末页中的部分与 CRC 拼接后一起写入, 避免末页被写两次 (末页只剩 1 字节时 CRC 跨页) */
+    tail_len = (address + length) % p_dev->config.page_size;
+    if (tail_len > length) {
+        tail_len = length;
+    }
+    head_len = length - tail_len;
+
+    if (head_len > 0) {
+        status = at24cxx_write(p_dev, address, p_data, head_len);
+        if (status != DRV_OK) {
+            return status;
+        }
+    }
+
+    crc = driver_crc16_ccitt(p_data, length);
+
+    memcpy(tail_buf, p_data + head_len, tail_len);
+    tail_buf[tail_len] = DRV_U16_HIGH(crc);
+    tail_buf[tail_len + 1] = DRV_U16_LOW(crc);
+
+    return at24cxx_write(p_dev, address + head_len, tail_buf, tail_len + AT24CXX_CRC_SIZE);
+}
+
+driver_status_t at24cxx_verify_crc(at24cxx_dev_t *p_dev,
+                                   uint32_t address,
+                                   uint32_t length)
+{
+    uint8_t chunk_buf[AT24CXX_CRC_CHUNK_SIZE + AT24CXX_CRC_SIZE];
+    uint32_t total;
+    uint32_t done;
+    uint32_t chunk;
+    uint16_t crc;
+    driver_status_t status;
+
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (length == 0 || length > UINT32_MAX - AT24CXX_CRC_SIZE ||
+        !static_range_valid(p_dev, address, length + AT24CXX_CRC_SIZE)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    /* 数据与 CRC 作为一个整体分段读取, 最后一段的末尾两字节即为 CRC */
+    total = length + AT24CXX_CRC_SIZE;
+    crc = DRV_CRC16_CCITT_INIT;
+    done = 0;
+
+    while (done < total) {
+        chunk = total - done;
+        if (chunk > sizeof(chunk_buf)) {
+            chunk = AT24CXX_CRC_CHUNK_SIZE;
+        }
+
+        status = at24cxx_read(p_dev, address + done, chunk_buf, chunk);
+        if (status != DRV_OK) {
+            return status;
+        }
+
+        if (done + chunk == total) {
+            crc = driver_crc16_ccitt_update(crc, chunk_buf, chunk - AT24CXX_CRC_SIZE);
+            return (crc == DRV_MAKE_U16(chunk_buf[chunk - 2], chunk_buf[chunk - 1])) ?
+                   DRV_OK : DRV_ERR_COMMON;
+        }
+
+        crc = driver_crc16_ccitt_update(crc, chunk_buf, chunk);
+        done += chunk;
+    }
+
+    return DRV_ERR_COMMON;
+}
+
+driver_status_t at24cxx_read_with_crc(at24cxx_dev_t *p_dev,
+                                      uint32_t address,
+                                      uint8_t *p_data,
+                                      uint32_t length)
+{
+    uint8_t tail_buf[AT24CXX_CRC_CHUNK_SIZE + AT24CXX_CRC_SIZE];
+    uint32_t head_len;
+    uint32_t tail_len;
+    driver_status_t status;
+
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_data == NULL || length == 0 || length > UINT32_MAX - AT24CXX_CRC_SIZE ||
+        !static_range_valid(p_dev, address, length + AT24CXX_CRC_SIZE)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    /* 数据末段与 CRC 一次读出; 不超过 AT24CXX_CRC_CHUNK_SIZE 的数据只需一次传输 */
+    tail_len = (length > AT24CXX_CRC_CHUNK_SIZE) ? AT24CXX_CRC_CHUNK_SIZE : length;
+    head_len = length - tail_len;
+
+    if (head_len > 0) {
+        status = at24cxx_read(p_dev, address, p_data, head_len);
+        if (status != DRV_OK) {
+            return status;
+        }
+    }
+
+    status = at24cxx_read(p_dev, address + head_len, tail_buf, tail_len + AT24CXX_CRC_SIZE);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    memcpy(p_data + head_len, tail_buf, tail_len);
+
+    if (driver_crc16_ccitt(p_data, length) != DRV_MAKE_U16(tail_buf[tail_len], tail_buf[tail_len + 1])) {
+        return DRV_ERR_COMMON;
+    }
+
+    return DRV_OK;
+}
+
 driver_status_t at24cxx_get_config(at24cxx_dev_t *p_dev,
                                    at24cxx_config_t *p_config)
 {
@@ -278,7 +752,7 @@ driver_status_t at24cxx_get_config(at24cxx_dev_t *p_dev,
     return DRV_OK;
 }
 
-uint16_t at24cxx_get_capacity(at24cxx_dev_t *p_dev)
+uint32_t at24cxx_get_capacity(at24cxx_dev_t *p_dev)
 {
     if (p_dev == NULL || !p_dev->is_initialized) {
         return 0;
@@ -296,80 +770,443 @@ uint16_t at24cxx_get_page_size(at24cxx_dev_t *p_dev)
     return p_dev->config.page_size;
 }
 
-/* --- 3. 私有函数实现 (Private Functions) --- */
+driver_status_t at24cxx_set_write_mode(at24cxx_dev_t *p_dev,
+                                       at24cxx_write_mode_t mode)
+{
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (mode != AT24CXX_WRITE_MODE_DIRECT && mode != AT24CXX_WRITE_MODE_COMPARE) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_dev->config.write_mode = mode;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_get_write_stats(at24cxx_dev_t *p_dev,
+                                        at24cxx_write_stats_t *p_stats)
+{
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_stats == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    *p_stats = p_dev->write_stats;
+
+    return DRV_OK;
+}
+
+/* --- 4. 私有函数实现 (Private Functions) --- */
+
+static driver_status_t static_poll_ack(at24cxx_dev_t *p_dev)
+{
+    uint8_t dummy;
+
+    p_dev->write_stats.poll_count++;
+
+    /* 写周期内芯片不应答 (NACK), 应答即表示内部写入完成 */
+    return p_dev->i2c_ops.read_reg(p_dev->i2c_user_data,
+                                   (p_dev->config.device_addr >> 1),
+                                   0,
+                                   &dummy,
+                                   1);
+}
 
 static driver_status_t static_wait_write_complete(at24cxx_dev_t *p_dev)
 {
     uint32_t retry_count;
-    uint32_t max_retries;
-    uint8_t dummy;
-    driver_status_t status;
-    uint8_t dev_addr_7bit;
+    uint32_t start_tick;
+    uint32_t elapsed_us;
+    uint32_t interval_us;
+
+    /* 未注入时间接口: 兼容旧行为, write_timeout_ms 作为轮询次数上限 */
+    if (!p_dev->has_time_ops) {
+        for (retry_count = 0; retry_count < p_dev->config.write_timeout_ms; retry_count++) {
+            if (static_poll_ack(p_dev) == DRV_OK) {
+                return DRV_OK;
+            }
+        }
+
+        return DRV_ERR_TIMEOUT;
+    }
 
-    max_retries = p_dev->config.write_timeout_ms;
-    dev_addr_7bit = p_dev->config.device_addr >> 1;
+    interval_us = p_dev->config.poll_interval_us;
+    start_tick = p_dev->time_ops.get_tick();
+    elapsed_us = 0;
 
-    for (retry_count = 0; retry_count < max_retries; retry_count++) {
-        status = p_dev->i2c_ops.read_reg(p_dev->i2c_user_data,
-                                            dev_addr_7bit,
-                                            0,
-                                            &dummy,
-                                            1);
+    /* 根据历史 tWR 估计值跳过必然失败的早期轮询, 只留一个轮询间隔的余量 */
+    if (p_dev->write_stats.estimate_twr_us > interval_us) {
+        elapsed_us = p_dev->write_stats.estimate_twr_us - interval_us;
+        p_dev->time_ops.delay_us(elapsed_us);
+    }
 
-        if (status == DRV_OK) {
+    while (1) {
+        if (static_poll_ack(p_dev) == DRV_OK) {
+            static_update_twr_stats(p_dev, elapsed_us);
             return DRV_OK;
         }
+
+        /* Tick 分辨率为 1ms, 使用严格大于以避免提前超时 */
+        if ((uint32_t)(p_dev->time_ops.get_tick() - start_tick) > p_dev->config.write_timeout_ms) {
+            return DRV_ERR_TIMEOUT;
+        }
+
+        p_dev->time_ops.delay_us(interval_us);
+        elapsed_us += interval_us;
+    }
+}
+
+static void static_update_twr_stats(at24cxx_dev_t *p_dev, uint32_t twr_us)
+{
+    at24cxx_write_stats_t *p_stats = &p_dev->write_stats;
+
+    p_stats->last_twr_us = twr_us;
+
+    if (twr_us > p_stats->max_twr_us) {
+        p_stats->max_twr_us = twr_us;
     }
 
-    return DRV_ERR_TIMEOUT;
+    /* 滑动平均 (权重 1/4), 首次观测直接采用 */
+    if (p_stats->estimate_twr_us == 0) {
+        p_stats->estimate_twr_us = twr_us;
+    } else {
+        p_stats->estimate_twr_us = p_stats->estimate_twr_us -
+                                   (p_stats->estimate_twr_us >> 2) +
+                                   (twr_us >> 2);
+    }
 }
 
-static driver_status_t static_write_page(at24cxx_dev_t *p_dev,
-                                         uint16_t address,
-                                         const uint8_t *p_data,
-                                         uint16_t length)
+static uint8_t static_dev_addr(at24cxx_dev_t *p_dev, uint32_t address)
 {
-    uint8_t *p_write_buf;
-    uint8_t addr_len;
+    /* 地址字节无法容纳的高位 (AT24C04/08/16 的 A8~A10, AT24CM01 的 A16) 作为块选择位 */
+    return (uint8_t)((p_dev->config.device_addr >> 1) |
+                     (address >> (8U * p_dev->config.addr_bytes)));
+}
+
+static bool static_range_valid(at24cxx_dev_t *p_dev, uint32_t address, uint32_t length)
+{
+    return address < p_dev->config.capacity && length <= p_dev->config.capacity - address;
+}
+
+static driver_status_t static_read_block(at24cxx_dev_t *p_dev,
+                                         uint32_t address,
+                                         uint8_t *p_data,
+                                         uint32_t length)
+{
+    uint8_t addr_buf[2];
     uint8_t dev_addr_7bit;
     driver_status_t status;
 
-    dev_addr_7bit = p_dev->config.device_addr >> 1;
-    addr_len = p_dev->config.addr_bytes;
+    dev_addr_7bit = static_dev_addr(p_dev, address);
 
-    p_write_buf = (uint8_t *)malloc(addr_len + length);
-    if (p_write_buf == NULL) {
-        return DRV_ERR_NO_MEM;
+    /* 组合写读: 地址阶段 + 重复起始读取, 任意长度均为一次传输 */
+    if (p_dev->i2c_ops.write_read != NULL) {
+        if (p_dev->config.addr_bytes == 1) {
+            addr_buf[0] = (uint8_t)address;
+        } else {
+            addr_buf[0] = (uint8_t)(address >> 8);
+            addr_buf[1] = (uint8_t)address;
+        }
+
+        return p_dev->i2c_ops.write_read(p_dev->i2c_user_data,
+                                         dev_addr_7bit,
+                                         addr_buf,
+                                         p_dev->config.addr_bytes,
+                                         p_data,
+                                         length);
     }
 
-    if (addr_len == 1) {
-        p_write_buf[0] = (uint8_t)address;
-        memcpy(p_write_buf + 1, p_data, length);
+    if (p_dev->config.addr_bytes == 1) {
+        return p_dev->i2c_ops.read_reg(p_dev->i2c_user_data,
+                                       dev_addr_7bit,
+                                       (uint8_t)address,
+                                       p_data,
+                                       length);
+    }
+
+    /*
+     * 回退路径 (未注入 write_read): 先以空数据写入设置地址指针, 再读取.
+     * 需两次传输, 且 read_reg 会额外发送一个地址字节, 依赖芯片忽略不完整的地址
+     */
+    addr_buf[0] = (uint8_t)(address >> 8);
+    addr_buf[1] = (uint8_t)address;
+
+    status = p_dev->i2c_ops.write_reg(p_dev->i2c_user_data,
+                                      dev_addr_7bit,
+                                      addr_buf[0],
+                                      &addr_buf[1],
+                                      1);
 
-        status = p_dev->i2c_ops.write_reg(p_dev->i2c_user_data,
-                                            dev_addr_7bit,
-                                            p_write_buf[0],
-                                            p_write_buf + 1,
-                                            length);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    return p_dev->i2c_ops.read_reg(p_dev->i2c_user_data,
+                                   dev_addr_7bit,
+                                   addr_buf[1],
+                                   p_data,
+                                   length);
+}
+
+static driver_status_t static_send_page(at24cxx_dev_t *p_dev,
+                                        uint32_t address,
+                                        const uint8_t *p_data,
+                                        uint16_t length,
+                                        bool use_async)
+{
+    const uint8_t *p_payload;
+    uint32_t payload_len;
+    uint8_t reg_addr;
+    uint8_t dev_addr_7bit;
+
+    /* 页不跨块, 整页使用同一个块选择地址 */
+    dev_addr_7bit = static_dev_addr(p_dev, address);
+
+    /*
+     * write_reg 的 reg_addr 作为第一个地址字节发送:
+     * 1字节地址直接透传数据; 2字节地址需将低地址字节与数据拼接
+     */
+    if (p_dev->config.addr_bytes == 1) {
+        reg_addr = (uint8_t)address;
+        p_payload = p_data;
+        payload_len = length;
     } else {
-        p_write_buf[0] = (uint8_t)(address >> 8);
-        p_write_buf[1] = (uint8_t)address;
-        memcpy(p_write_buf + 2, p_data, length);
+        reg_addr = (uint8_t)(address >> 8);
+        p_dev->tx_buf[0] = (uint8_t)address;
+        memcpy(&p_dev->tx_buf[1], p_data, length);
+        p_payload = p_dev->tx_buf;
+        payload_len = (uint32_t)length + 1;
+    }
 
-        status = p_dev->i2c_ops.write_reg(p_dev->i2c_user_data,
-                                            dev_addr_7bit,
-                                            p_write_buf[0],
-                                            p_write_buf + 1,
-                                            length + 1);
+    if (use_async && p_dev->i2c_ops.write_reg_async != NULL) {
+        return p_dev->i2c_ops.write_reg_async(p_dev->i2c_user_data,
+                                              dev_addr_7bit,
+                                              reg_addr,
+                                              p_payload,
+                                              payload_len,
+                                              static_async_page_sent,
+                                              p_dev);
     }
 
-    free(p_write_buf);
+    return p_dev->i2c_ops.write_reg(p_dev->i2c_user_data,
+                                    dev_addr_7bit,
+                                    reg_addr,
+                                    p_payload,
+                                    payload_len);
+}
+
+static driver_status_t static_write_page(at24cxx_dev_t *p_dev,
+                                         uint32_t address,
+                                         const uint8_t *p_data,
+                                         uint16_t length)
+{
+    driver_status_t status;
+
+    status = static_send_page(p_dev, address, p_data, length, false);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    p_dev->write_stats.page_write_count++;
+
+    return static_wait_write_complete(p_dev);
+}
+
+static driver_status_t static_write_page_changed(at24cxx_dev_t *p_dev,
+                                                 uint32_t address,
+                                                 const uint8_t *p_data,
+                                                 uint16_t length)
+{
+    uint8_t read_buf[AT24CXX_MAX_PAGE_SIZE];
+    uint16_t first;
+    uint16_t last;
+    driver_status_t status;
 
+    status = at24cxx_read(p_dev, address, read_buf, length);
     if (status != DRV_OK) {
         return status;
     }
 
-    status = static_wait_write_complete(p_dev);
+    first = 0;
+    while (first < length && read_buf[first] == p_data[first]) {
+        first++;
+    }
+
+    if (first == length) {
+        p_dev->write_stats.skipped_page_count++;
+        p_dev->write_stats.skipped_byte_count += length;
+        return DRV_OK;
+    }
+
+    last = length - 1;
+    while (last > first && read_buf[last] == p_data[last]) {
+        last--;
+    }
+
+    /* 只重写首尾差异字节之间的连续区间, 仍为一次页写入 */
+    p_dev->write_stats.skipped_byte_count += length - (last - first + 1);
+
+    return static_write_page(p_dev, address + first, p_data + first, last - first + 1);
+}
+
+static uint16_t static_page_chunk(at24cxx_dev_t *p_dev,
+                                  uint32_t address,
+                                  uint32_t remaining)
+{
+    uint16_t page_space;
+
+    page_space = (uint16_t)(p_dev->config.page_size - (address % p_dev->config.page_size));
+
+    return remaining < page_space ? (uint16_t)remaining : page_space;
+}
+
+static driver_status_t static_send_erase_page(at24cxx_dev_t *p_dev,
+                                              uint32_t address,
+                                              uint16_t length)
+{
+    /* tx_buf[1..] 已填充 0xFF, 直接发送, 不经过 static_send_page 的数据拷贝 */
+    if (p_dev->config.addr_bytes == 1) {
+        return p_dev->i2c_ops.write_reg(p_dev->i2c_user_data,
+                                        static_dev_addr(p_dev, address),
+                                        (uint8_t)address,
+                                        &p_dev->tx_buf[1],
+                                        length);
+    }
+
+    p_dev->tx_buf[0] = (uint8_t)address;
+
+    return p_dev->i2c_ops.write_reg(p_dev->i2c_user_data,
+                                    static_dev_addr(p_dev, address),
+                                    (uint8_t)(address >> 8),
+                                    p_dev->tx_buf,
+                                    (uint32_t)length + 1);
+}
+
+static driver_status_t static_erase_transfer(at24cxx_dev_t *p_dev,
+                                             bool write_pending,
+                                             uint32_t address,
+                                             uint16_t length,
+                                             uint8_t *p_read_buf)
+{
+    uint32_t retry_count;
+    uint32_t start_tick;
+    uint32_t elapsed_us;
+    uint32_t interval_us;
+    driver_status_t status;
+
+    /*
+     * 上一页仍在写周期中时, 下一次传输 (读取检查或下一页写入) 兼作 ACK 轮询:
+     * 芯片应答即说明写周期结束且本次传输已完成, 省去单独的轮询传输
+     */
+    interval_us = p_dev->config.poll_interval_us;
+    elapsed_us = 0;
+    start_tick = 0;
+
+    if (write_pending && p_dev->has_time_ops) {
+        start_tick = p_dev->time_ops.get_tick();
+
+        if (p_dev->write_stats.estimate_twr_us > interval_us) {
+            elapsed_us = p_dev->write_stats.estimate_twr_us - interval_us;
+            p_dev->time_ops.delay_us(elapsed_us);
+        }
+    }
+
+    for (retry_count = 0; ; retry_count++) {
+        if (p_read_buf != NULL) {
+            status = static_read_block(p_dev, address, p_read_buf, length);
+        } else {
+            status = static_send_erase_page(p_dev, address, length);
+        }
+
+        if (status == DRV_OK || !write_pending) {
+            break;
+        }
+
+        p_dev->write_stats.poll_count++;
+
+        if (!p_dev->has_time_ops) {
+            /* 兼容旧行为: write_timeout_ms 作为轮询次数上限 */
+            if (retry_count + 1U >= p_dev->config.write_timeout_ms) {
+                return DRV_ERR_TIMEOUT;
+            }
+            continue;
+        }
+
+        if ((uint32_t)(p_dev->time_ops.get_tick() - start_tick) > p_dev->config.write_timeout_ms) {
+            return DRV_ERR_TIMEOUT;
+        }
+
+        p_dev->time_ops.delay_us(interval_us);
+        elapsed_us += interval_us;
+    }
+
+    if (status == DRV_OK && write_pending && p_dev->has_time_ops) {
+        static_update_twr_stats(p_dev, elapsed_us);
+    }
 
     return status;
 }
+
+static driver_status_t static_job_send_next(at24cxx_dev_t *p_dev)
+{
+    at24cxx_write_job_t *p_job = &p_dev->write_job;
+    uint32_t address;
+    driver_status_t status;
+
+    address = p_job->address + p_job->offset;
+    p_job->chunk_len = static_page_chunk(p_dev, address, p_job->length - p_job->offset);
+    p_job->poll_attempts = 0;
+    p_job->bus_status = DRV_OK;
+
+    if (p_dev->i2c_ops.write_reg_async != NULL) {
+        /* 回调可能在 write_reg_async 返回前触发, 需先切换状态 */
+        p_job->state = AT24CXX_WRITE_STATE_SENDING;
+    }
+
+    status = static_send_page(p_dev, address, p_job->p_data + p_job->offset,
+                              p_job->chunk_len, true);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    if (p_dev->i2c_ops.write_reg_async == NULL) {
+        if (p_dev->has_time_ops) {
+            p_job->cycle_start_tick = p_dev->time_ops.get_tick();
+        }
+        p_job->state = AT24CXX_WRITE_STATE_WRITE_CYCLE;
+    }
+
+    return DRV_OK;
+}
+
+static driver_status_t static_job_finish(at24cxx_dev_t *p_dev, driver_status_t result)
+{
+    at24cxx_write_job_t *p_job = &p_dev->write_job;
+
+    p_job->state = AT24CXX_WRITE_STATE_IDLE;
+    p_job->result = result;
+
+    if (p_job->cb != NULL) {
+        p_job->cb(p_job->user_data, result);
+    }
+
+    return result;
+}
+
+static void static_async_page_sent(void *user_data, driver_status_t status)
+{
+    at24cxx_dev_t *p_dev = (at24cxx_dev_t *)user_data;
+
+    /* 可能运行于中断上下文: 只记录结果与写周期开始时刻, 由 at24cxx_write_step() 推进 */
+    if (p_dev->has_time_ops) {
+        p_dev->write_job.cycle_start_tick = p_dev->time_ops.get_tick();
+    }
+    p_dev->write_job.bus_status = status;
+    p_dev->write_job.state = AT24CXX_WRITE_STATE_WRITE_CYCLE;
+}
@@ -11,6 +11,25 @@
 extern "C" {
 #endif
 
+/* --- 0. 编译期配置 (Compile-time Options) --- */
+
+/**
+ * @brief 支持的最大页大小, 决定设备句柄内发送缓冲区大小
+ * @note  AT24C512 需定义为 128, AT24CM01 需定义为 256
+ */
+#ifndef AT24CXX_MAX_PAGE_SIZE
+#define AT24CXX_MAX_PAGE_SIZE   64
+#endif
+
+/**
+ * @brief CRC 校验读取的分段大小 (栈上缓冲区)
+ */
+#ifndef AT24CXX_CRC_CHUNK_SIZE
+#define AT24CXX_CRC_CHUNK_SIZE  64
+#endif
+
+#define AT24CXX_CRC_SIZE        2U      /**< 数据后附加的 CRC-16-CCITT 字节数 (大端) */
+
 /* --- 1. 设备型号定义 (Device Models) --- */
 typedef enum {
     AT24CXX_MODEL_01  = 1,    /**< AT24C01:  128 bytes,   8-byte page */
@@ -21,23 +40,85 @@ typedef enum {
     AT24CXX_MODEL_32  = 32,   /**< AT24C32:  4KB,        32-byte page */
     AT24CXX_MODEL_64  = 64,   /**< AT24C64:  8KB,        32-byte page */
     AT24CXX_MODEL_128 = 128,  /**< AT24C128: 16KB,       64-byte page */
-    AT24CXX_MODEL_256 = 256   /**< AT24C256: 32KB,       64-byte page */
+    AT24CXX_MODEL_256 = 256,  /**< AT24C256: 32KB,       64-byte page */
+    AT24CXX_MODEL_512 = 512,  /**< AT24C512: 64KB,      128-byte page */
+    AT24CXX_MODEL_M01 = 1024  /**< AT24CM01: 128KB,     256-byte page */
 } at24cxx_model_t;
 
+/**
+ * @brief 写入模式
+ */
+typedef enum {
+    AT24CXX_WRITE_MODE_DIRECT  = 0,  /**< 直接写入所有涉及的页 */
+    AT24CXX_WRITE_MODE_COMPARE = 1   /**< 先读后比较: 跳过相同的页, 只写入变化的最小连续区间 */
+} at24cxx_write_mode_t;
+
 /* --- 2. 设备配置结构体 (Device Configuration) --- */
 typedef struct {
     uint8_t  device_addr;      /**< I2C设备地址 (7位地址, 如 0x50) */
     uint16_t page_size;        /**< 页写入大小 (bytes) */
-    uint16_t capacity;         /**< 总容量 (bytes) */
-    uint8_t  addr_bytes;       /**< 地址字节数 (1 or 2) */
+    uint32_t capacity;         /**< 总容量 (bytes) */
+    uint8_t  addr_bytes;       /**< 地址字节数 (1 or 2), 超出部分的高地址位放入设备地址的块选择位 */
     uint32_t write_timeout_ms; /**< 写入超时时间 (ms), 默认10ms */
+    uint16_t poll_interval_us; /**< ACK轮询间隔 (us), 默认200us, 需注入时间接口 */
+    at24cxx_write_mode_t write_mode; /**< 写入模式, 默认直接写入 */
 } at24cxx_config_t;
 
+/**
+ * @brief 写周期 (tWR) 统计信息
+ * @note  仅在注入时间接口后有效; 阻塞写入的时间分辨率为 poll_interval_us,
+ *        非阻塞写入 (at24cxx_write_step) 为 get_tick 的 1ms
+ */
+typedef struct {
+    uint32_t last_twr_us;          /**< 最近一次观测到的写周期 (us) */
+    uint32_t max_twr_us;           /**< 观测到的最大写周期 (us) */
+    uint32_t estimate_twr_us;      /**< 写周期估计值 (滑动平均, 用于自适应轮询) */
+    uint32_t page_write_count;     /**< 累计页写入次数 */
+    uint32_t poll_count;           /**< 累计ACK轮询次数 */
+    uint32_t skipped_page_count;   /**< 比较模式 (或跳过已擦除页的擦除) 中未写入的页数 */
+    uint32_t skipped_byte_count;   /**< 比较模式 (或跳过已擦除页的擦除) 中未重写的字节数 */
+} at24cxx_write_stats_t;
+
+/**
+ * @brief 非阻塞写入状态
+ */
+typedef enum {
+    AT24CXX_WRITE_STATE_IDLE        = 0,  /**< 空闲 (无进行中的写入) */
+    AT24CXX_WRITE_STATE_SENDING     = 1,  /**< 页数据正在总线上传输 (异步) */
+    AT24CXX_WRITE_STATE_WRITE_CYCLE = 2   /**< 芯片内部写周期中, 等待ACK */
+} at24cxx_write_state_t;
+
+/**
+ * @brief 非阻塞写入任务上下文
+ * @note  由驱动内部维护, 应用层只读
+ */
+typedef struct {
+    volatile at24cxx_write_state_t state;      /**< 当前状态 */
+    volatile driver_status_t bus_status;       /**< 最近一次异步传输结果 */
+    driver_status_t result;                    /**< 最近一次写入任务的最终结果 */
+    const uint8_t *p_data;                     /**< 写入数据 (任务完成前必须保持有效) */
+    uint32_t address;                          /**< 起始地址 */
+    uint32_t length;                           /**< 总长度 */
+    uint32_t offset;                           /**< 已完成写入的字节数 */
+    uint16_t chunk_len;                        /**< 当前页写入长度 */
+    uint32_t cycle_start_tick;                 /**< 写周期开始的Tick */
+    uint32_t last_nack_tick;                   /**< 最近一次轮询未应答的Tick */
+    uint32_t poll_attempts;                    /**< 当前写周期的轮询次数 */
+    driver_completion_callback_t cb;           /**< 任务完成回调 (可为NULL) */
+    void *user_data;                           /**< 回调用户数据 */
+} at24cxx_write_job_t;
+
 /* --- 3. 设备句柄结构体 (Device Handle) --- */
 typedef struct {
     driver_i2c_ops_t i2c_ops;      /**< I2C操作接口 */
+    driver_time_ops_t time_ops;    /**< 时间接口 (可选, 用于ACK轮询计时) */
     at24cxx_config_t config;       /**< 设备配置 */
     void *i2c_user_data;           /**< I2C用户数据 (如 I2C_HandleTypeDef*) */
+    at24cxx_write_stats_t write_stats; /**< 写周期统计 */
+    at24cxx_write_job_t write_job; /**< 非阻塞写入任务 */
+    uint8_t tx_buf[AT24CXX_MAX_PAGE_SIZE + 1]; /**< 页写发送缓冲区 (低地址字节 + 页数据) */
+    uint8_t rx_addr_buf[2];        /**< 非阻塞读取的地址阶段缓冲区 */
+    bool has_time_ops;             /**< 是否已注入时间接口 */
     bool is_initialized;           /**< 初始化标志 */
 } at24cxx_dev_t;
 
@@ -57,6 +138,16 @@ driver_status_t at24cxx_init(at24cxx_dev_t *p_dev,
                              const at24cxx_config_t *p_config,
                              void *i2c_user_data);
 
+/**
+ * @brief 注入时间接口, 启用基于时间的ACK轮询
+ * @param p_dev 设备句柄指针
+ * @param p_time_ops 时间接口 (需提供 get_tick 和 delay_us)
+ * @return driver_status_t
+ * @note  未注入时, write_timeout_ms 退化为轮询次数上限 (兼容旧行为)
+ */
+driver_status_t at24cxx_set_time_ops(at24cxx_dev_t *p_dev,
+                                     const driver_time_ops_t *p_time_ops);
+
 /**
  * @brief 检测 EEPROM 是否存在
  * @param p_dev 设备句柄指针
@@ -73,11 +164,34 @@ driver_status_t at24cxx_probe(at24cxx_dev_t *p_dev);
  * @param p_data 读取数据缓冲区
  * @param length 读取长度 (bytes)
  * @return driver_status_t
+ * @note  连续读取只在块边界处拆分 (1字节地址型号每256字节, AT24CM01每64KB),
+ *        其余情况下整段读取为一次传输
  */
 driver_status_t at24cxx_read(at24cxx_dev_t *p_dev,
-                             uint16_t address,
+                             uint32_t address,
                              uint8_t *p_data,
-                             uint16_t length);
+                             uint32_t length);
+
+/**
+ * @brief 启动非阻塞读取 (一次总线传输)
+ * @param p_dev 设备句柄指针
+ * @param address 起始地址
+ * @param p_data 读取数据缓冲区 (完成回调前不得访问)
+ * @param length 读取长度 (bytes), 不得跨越块边界
+ * @param cb 完成回调 (在总线完成中断上下文中执行)
+ * @param user_data 回调用户数据
+ * @return driver_status_t
+ * @retval DRV_ERR_NOT_SUPPORT 未注入所需的异步接口
+ * @retval DRV_ERR_BUSY 非阻塞写入进行中
+ * @note  优先使用 write_read_async; 1字节地址型号可退化为 read_reg_async.
+ *        地址阶段数据保存在设备句柄中, 同一设备同时只能有一个非阻塞读取.
+ */
+driver_status_t at24cxx_read_async(at24cxx_dev_t *p_dev,
+                                   uint32_t address,
+                                   uint8_t *p_data,
+                                   uint32_t length,
+                                   driver_completion_callback_t cb,
+                                   void *user_data);
 
 /**
  * @brief 向 EEPROM 写入数据
@@ -86,12 +200,50 @@ driver_status_t at24cxx_read(at24cxx_dev_t *p_dev,
  * @param p_data 写入数据缓冲区
  * @param length 写入长度 (bytes)
  * @return driver_status_t
- * @note 内部自动处理页写入优化
+ * @note 内部自动处理页写入优化; 比较模式下每页先读取再只写入变化部分
  */
 driver_status_t at24cxx_write(at24cxx_dev_t *p_dev,
-                              uint16_t address,
+                              uint32_t address,
                               const uint8_t *p_data,
-                              uint16_t length);
+                              uint32_t length);
+
+/**
+ * @brief 启动非阻塞写入
+ * @param p_dev 设备句柄指针
+ * @param address 起始地址
+ * @param p_data 写入数据缓冲区 (任务完成前必须保持有效)
+ * @param length 写入长度 (bytes)
+ * @param cb 任务完成回调 (可为NULL), 在 at24cxx_write_step() 的调用上下文中执行
+ * @param user_data 回调用户数据
+ * @return driver_status_t
+ * @retval DRV_OK 第一页已发出
+ * @retval DRV_ERR_BUSY 已有写入任务在进行
+ * @note  只发出第一页即返回; 若注入了 write_reg_async 则页传输也不阻塞.
+ *        芯片处于写周期期间, 总线可用于访问其他设备.
+ */
+driver_status_t at24cxx_write_begin(at24cxx_dev_t *p_dev,
+                                    uint32_t address,
+                                    const uint8_t *p_data,
+                                    uint32_t length,
+                                    driver_completion_callback_t cb,
+                                    void *user_data);
+
+/**
+ * @brief 推进非阻塞写入 (每次调用最多一次ACK轮询或一次页发送)
+ * @param p_dev 设备句柄指针
+ * @return driver_status_t
+ * @retval DRV_OK 写入任务已全部完成 (或无任务)
+ * @retval DRV_ERR_BUSY 写入仍在进行, 需稍后再次调用
+ * @retval 其他 写入失败 (任务已终止)
+ */
+driver_status_t at24cxx_write_step(at24cxx_dev_t *p_dev);
+
+/**
+ * @brief 查询非阻塞写入状态 (不产生总线操作)
+ * @param p_dev 设备句柄指针
+ * @return DRV_ERR_BUSY 进行中, 否则为最近一次任务的结果
+ */
+driver_status_t at24cxx_write_poll(at24cxx_dev_t *p_dev);
 
 /**
  * @brief 擦除 EEPROM (填充为 0xFF)
@@ -99,10 +251,34 @@ driver_status_t at24cxx_write(at24cxx_dev_t *p_dev,
  * @param address 起始地址
  * @param length 擦除长度 (bytes)
  * @return driver_status_t
+ * @note  等价于 at24cxx_erase_range(p_dev, address, length, false)
  */
 driver_status_t at24cxx_erase(at24cxx_dev_t *p_dev,
-                              uint16_t address,
-                              uint16_t length);
+                              uint32_t address,
+                              uint32_t length);
+
+/**
+ * @brief 擦除指定区域 (填充为 0xFF)
+ * @param p_dev 设备句柄指针
+ * @param address 起始地址
+ * @param length 擦除长度 (bytes)
+ * @param skip_erased true: 先读取每页, 已全部为 0xFF 的页不再写入
+ * @return driver_status_t
+ * @note  不分配缓冲区: 0xFF 数据直接填充在设备发送缓冲区中, 各页复用.
+ *        上一页的写周期内发起的下一次传输兼作 ACK 轮询, 每页省去一次轮询传输.
+ */
+driver_status_t at24cxx_erase_range(at24cxx_dev_t *p_dev,
+                                    uint32_t address,
+                                    uint32_t length,
+                                    bool skip_erased);
+
+/**
+ * @brief 擦除整片 EEPROM
+ * @param p_dev 设备句柄指针
+ * @param skip_erased true: 跳过已擦除的页
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_erase_chip(at24cxx_dev_t *p_dev, bool skip_erased);
 
 /**
  * @brief 读取单个字节
@@ -112,7 +288,7 @@ driver_status_t at24cxx_erase(at24cxx_dev_t *p_dev,
  * @return driver_status_t
  */
 driver_status_t at24cxx_read_byte(at24cxx_dev_t *p_dev,
-                                  uint16_t address,
+                                  uint32_t address,
                                   uint8_t *p_data);
 
 /**
@@ -123,7 +299,7 @@ driver_status_t at24cxx_read_byte(at24cxx_dev_t *p_dev,
  * @return driver_status_t
  */
 driver_status_t at24cxx_write_byte(at24cxx_dev_t *p_dev,
-                                   uint16_t address,
+                                   uint32_t address,
                                    uint8_t data);
 
 /**
@@ -137,9 +313,56 @@ driver_status_t at24cxx_write_byte(at24cxx_dev_t *p_dev,
  * @retval DRV_ERR_COMMON 数据不一致
  */
 driver_status_t at24cxx_verify(at24cxx_dev_t *p_dev,
-                               uint16_t address,
+                               uint32_t address,
                                const uint8_t *p_data,
-                               uint16_t length);
+                               uint32_t length);
+
+/**
+ * @brief 写入数据并在其后附加 CRC-16-CCITT
+ * @param p_dev 设备句柄指针
+ * @param address 起始地址
+ * @param p_data 写入数据缓冲区
+ * @param length 数据长度 (bytes), 占用 length + AT24CXX_CRC_SIZE 字节
+ * @return driver_status_t
+ * @note  数据末页与 CRC 合并为同一次页写入, 不额外增加写周期.
+ *        例外: 数据末页只剩 1 字节空位时 CRC 跨越页边界, 高字节随数据末页写入,
+ *        低字节单独占用下一页的一次写周期; 两次写周期之间掉电时 CRC 不完整,
+ *        at24cxx_verify_crc() / at24cxx_read_with_crc() 会报告校验失败
+ */
+driver_status_t at24cxx_write_with_crc(at24cxx_dev_t *p_dev,
+                                       uint32_t address,
+                                       const uint8_t *p_data,
+                                       uint32_t length);
+
+/**
+ * @brief 校验 at24cxx_write_with_crc() 写入的数据 (无需原始数据副本)
+ * @param p_dev 设备句柄指针
+ * @param address 起始地址
+ * @param length 数据长度 (bytes, 不含CRC)
+ * @return driver_status_t
+ * @retval DRV_OK 校验通过
+ * @retval DRV_ERR_COMMON 校验失败
+ * @note  按 AT24CXX_CRC_CHUNK_SIZE 分段读取, 不分配与数据等长的缓冲区
+ */
+driver_status_t at24cxx_verify_crc(at24cxx_dev_t *p_dev,
+                                   uint32_t address,
+                                   uint32_t length);
+
+/**
+ * @brief 读取 at24cxx_write_with_crc() 写入的数据并校验
+ * @param p_dev 设备句柄指针
+ * @param address 起始地址
+ * @param p_data 读取数据缓冲区 (length 字节)
+ * @param length 数据长度 (bytes, 不含CRC)
+ * @return driver_status_t
+ * @retval DRV_ERR_COMMON 校验失败 (p_data 内容不可信)
+ * @note  数据末段 (最多 AT24CXX_CRC_CHUNK_SIZE 字节) 与 CRC 在同一次传输中读出,
+ *        短数据只需一次读取
+ */
+driver_status_t at24cxx_read_with_crc(at24cxx_dev_t *p_dev,
+                                      uint32_t address,
+                                      uint8_t *p_data,
+                                      uint32_t length);
 
 /**
  * @brief 获取设备配置信息
@@ -155,7 +378,7 @@ driver_status_t at24cxx_get_config(at24cxx_dev_t *p_dev,
  * @param p_dev 设备句柄指针
  * @return 容量 (bytes)
  */
-uint16_t at24cxx_get_capacity(at24cxx_dev_t *p_dev);
+uint32_t at24cxx_get_capacity(at24cxx_dev_t *p_dev);
 
 /**
  * @brief 获取页大小
@@ -164,6 +387,24 @@ uint16_t at24cxx_get_capacity(at24cxx_dev_t *p_dev);
  */
 uint16_t at24cxx_get_page_size(at24cxx_dev_t *p_dev);
 
+/**
+ * @brief 设置写入模式
+ * @param p_dev 设备句柄指针
+ * @param mode 写入模式
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_set_write_mode(at24cxx_dev_t *p_dev,
+                                       at24cxx_write_mode_t mode);
+
+/**
+ * @brief 获取写周期统计信息
+ * @param p_dev 设备句柄指针
+ * @param p_stats 输出统计信息
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_get_write_stats(at24cxx_dev_t *p_dev,
+                                        at24cxx_write_stats_t *p_stats);
+
 /* --- 5. 辅助宏 (Helper Macros) --- */
 
 /**
@@ -173,12 +414,16 @@ uint16_t at24cxx_get_page_size(at24cxx_dev_t *p_dev);
  */
 #define AT24CXX_GET_DEFAULT_CONFIG(model) ((at24cxx_config_t){ \
     .device_addr = 0xA0, \
-    .page_size = (model) >= AT24CXX_MODEL_128 ? 64 : \
+    .page_size = (model) >= AT24CXX_MODEL_M01 ? 256 : \
+                 (model) >= AT24CXX_MODEL_512 ? 128 : \
+                 (model) >= AT24CXX_MODEL_128 ? 64 : \
                  (model) >= AT24CXX_MODEL_32 ? 32 : \
                  (model) >= AT24CXX_MODEL_04 ? 16 : 8, \
-    .capacity = (model) * 128, \
+    .capacity = (uint32_t)(model) * 128U, \
     .addr_bytes = (model) >= AT24CXX_MODEL_32 ? 2 : 1, \
-    .write_timeout_ms = 10 \
+    .write_timeout_ms = 10, \
+    .poll_interval_us = 200, \
+    .write_mode = AT24CXX_WRITE_MODE_DIRECT \
 })
 
 #ifdef __cplusplus
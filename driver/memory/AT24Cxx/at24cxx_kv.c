@@ -0,0 +1,524 @@
+#include "at24cxx_kv.h"
+#include "../../../core/driver_crc.h"
+#include <string.h>
+
+/* --- 1. 私有宏定义 (Private Macros) --- */
+
+/*
+ * 记录布局 (record_size 字节):
+ * [0] 魔数  [1] 键  [2] 值长度  [3] 标志  [4..7] 序号(大端)
+ * [8 .. 8+len) 值, 其余填充 0xFF
+ * [record_size-2 .. record_size-1] CRC-16/CCITT (覆盖之前所有字节)
+ */
+#define KV_RECORD_MAGIC         0x5AU
+#define KV_FLAG_TOMBSTONE       0x01U
+#define KV_OFFSET_MAGIC         0
+#define KV_OFFSET_KEY           1
+#define KV_OFFSET_LENGTH        2
+#define KV_OFFSET_FLAGS         3
+#define KV_OFFSET_SEQ           4
+#define KV_OFFSET_VALUE         8
+#define KV_MIN_RECORD_SIZE      16U
+#define KV_DEFAULT_GC_RESERVE   2U
+
+/* 序号比较 (允许回绕): a 比 b 新 */
+#define KV_SEQ_NEWER(a, b)      ((int32_t)((uint32_t)(a) - (uint32_t)(b)) > 0)
+
+/* --- 2. 私有函数声明 (Private Functions) --- */
+
+static bool static_record_valid(const at24cxx_kv_t *p_kv, const uint8_t *p_record);
+static uint32_t static_slot_address(const at24cxx_kv_t *p_kv, uint16_t slot);
+static driver_status_t static_read_slot(at24cxx_kv_t *p_kv, uint16_t slot, uint8_t *p_record);
+static driver_status_t static_scan(at24cxx_kv_t *p_kv);
+static driver_status_t static_append(at24cxx_kv_t *p_kv, uint8_t key, uint8_t flags,
+                                     const uint8_t *p_value, uint8_t length);
+static driver_status_t static_write_record(at24cxx_kv_t *p_kv, uint8_t key, uint8_t flags,
+                                           const uint8_t *p_value, uint8_t length);
+static driver_status_t static_gc_step(at24cxx_kv_t *p_kv);
+
+/* --- 3. 公共函数实现 (Public Functions) --- */
+
+driver_status_t at24cxx_kv_init(at24cxx_kv_t *p_kv,
+                                at24cxx_dev_t *p_dev,
+                                const at24cxx_kv_config_t *p_config,
+                                uint16_t *p_index,
+                                uint16_t max_keys)
+{
+    uint16_t page_size;
+    uint8_t record_size;
+    uint32_t slot_count;
+    driver_status_t status;
+
+    if (p_kv == NULL || p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_config == NULL || p_index == NULL || max_keys == 0 || max_keys > 256) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    page_size = p_dev->config.page_size;
+    record_size = p_config->record_size;
+
+    /* 记录槽必须整除页大小, 保证每条记录只占用一次页写入 */
+    if (record_size < KV_MIN_RECORD_SIZE || record_size > AT24CXX_KV_MAX_RECORD_SIZE ||
+        (record_size & (record_size - 1)) != 0 || record_size > page_size) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if ((p_config->base_address % page_size) != 0 || p_config->region_size == 0 ||
+        (p_config->region_size % page_size) != 0 ||
+        p_config->base_address >= p_dev->config.capacity ||
+        p_config->region_size > p_dev->config.capacity - p_config->base_address) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    slot_count = p_config->region_size / record_size;
+    if (slot_count >= AT24CXX_KV_INVALID_SLOT) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    memset(p_kv, 0, sizeof(at24cxx_kv_t));
+
+    p_kv->p_dev = p_dev;
+    p_kv->config = *p_config;
+    p_kv->p_index = p_index;
+    p_kv->max_keys = max_keys;
+    p_kv->slot_count = (uint16_t)slot_count;
+
+    if (p_kv->config.gc_reserve < KV_DEFAULT_GC_RESERVE) {
+        p_kv->config.gc_reserve = KV_DEFAULT_GC_RESERVE;
+    }
+
+    if (p_kv->config.gc_reserve >= p_kv->slot_count) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    status = static_scan(p_kv);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    p_kv->is_initialized = true;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_kv_get(at24cxx_kv_t *p_kv,
+                               uint8_t key,
+                               uint8_t *p_value,
+                               uint8_t buf_size,
+                               uint8_t *p_length)
+{
+    uint8_t record[AT24CXX_KV_MAX_RECORD_SIZE];
+    uint16_t slot;
+    uint8_t length;
+    driver_status_t status;
+
+    if (p_kv == NULL || !p_kv->is_initialized || p_value == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (key >= p_kv->max_keys) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    slot = p_kv->p_index[key];
+    if (slot == AT24CXX_KV_INVALID_SLOT) {
+        return DRV_ERR_COMMON;
+    }
+
+    status = static_read_slot(p_kv, slot, record);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    if (!static_record_valid(p_kv, record) || record[KV_OFFSET_KEY] != key) {
+        return DRV_ERR_IO;
+    }
+
+    length = record[KV_OFFSET_LENGTH];
+    if (length > buf_size) {
+        return DRV_ERR_NO_MEM;
+    }
+
+    memcpy(p_value, &record[KV_OFFSET_VALUE], length);
+
+    if (p_length != NULL) {
+        *p_length = length;
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_kv_set(at24cxx_kv_t *p_kv,
+                               uint8_t key,
+                               const uint8_t *p_value,
+                               uint8_t length)
+{
+    uint8_t record[AT24CXX_KV_MAX_RECORD_SIZE];
+    uint16_t slot;
+
+    if (p_kv == NULL || !p_kv->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (key >= p_kv->max_keys || (p_value == NULL && length != 0)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (length > AT24CXX_KV_VALUE_CAPACITY(p_kv->config.record_size)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    /* 值未变化时不追加, 节省写周期与擦写寿命 */
+    slot = p_kv->p_index[key];
+    if (slot != AT24CXX_KV_INVALID_SLOT &&
+        static_read_slot(p_kv, slot, record) == DRV_OK &&
+        static_record_valid(p_kv, record) &&
+        record[KV_OFFSET_LENGTH] == length &&
+        (length == 0 || memcmp(&record[KV_OFFSET_VALUE], p_value, length) == 0)) {
+        return DRV_OK;
+    }
+
+    return static_append(p_kv, key, 0, p_value, length);
+}
+
+driver_status_t at24cxx_kv_delete(at24cxx_kv_t *p_kv, uint8_t key)
+{
+    if (p_kv == NULL || !p_kv->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (key >= p_kv->max_keys) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_kv->p_index[key] == AT24CXX_KV_INVALID_SLOT) {
+        return DRV_OK;
+    }
+
+    return static_append(p_kv, key, KV_FLAG_TOMBSTONE, NULL, 0);
+}
+
+driver_status_t at24cxx_kv_gc(at24cxx_kv_t *p_kv, uint16_t min_free)
+{
+    uint32_t budget;
+    driver_status_t status;
+
+    if (p_kv == NULL || !p_kv->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (min_free > p_kv->slot_count - p_kv->stats.live_count) {
+        return DRV_ERR_NO_MEM;
+    }
+
+    /* 每个槽最多处理一次, 防止异常情况下死循环 */
+    budget = p_kv->slot_count;
+    while (p_kv->stats.free_slots < min_free) {
+        if (budget-- == 0) {
+            return DRV_ERR_NO_MEM;
+        }
+
+        status = static_gc_step(p_kv);
+        if (status != DRV_OK) {
+            return status;
+        }
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_kv_format(at24cxx_kv_t *p_kv)
+{
+    driver_status_t status;
+
+    if (p_kv == NULL || !p_kv->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    status = at24cxx_erase(p_kv->p_dev, p_kv->config.base_address, p_kv->config.region_size);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    return static_scan(p_kv);
+}
+
+driver_status_t at24cxx_kv_get_stats(at24cxx_kv_t *p_kv, at24cxx_kv_stats_t *p_stats)
+{
+    if (p_kv == NULL || !p_kv->is_initialized || p_stats == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    *p_stats = p_kv->stats;
+
+    return DRV_OK;
+}
+
+/* --- 4. 私有函数实现 (Private Functions) --- */
+
+static bool static_record_valid(const at24cxx_kv_t *p_kv, const uint8_t *p_record)
+{
+    uint8_t record_size = p_kv->config.record_size;
+
+    if (p_record[KV_OFFSET_MAGIC] != KV_RECORD_MAGIC) {
+        return false;
+    }
+
+    if (p_record[KV_OFFSET_LENGTH] > AT24CXX_KV_VALUE_CAPACITY(record_size)) {
+        return false;
+    }
+
+    return driver_crc16_ccitt_check(p_record, record_size - 2U);
+}
+
+static uint32_t static_slot_address(const at24cxx_kv_t *p_kv, uint16_t slot)
+{
+    return p_kv->config.base_address + (uint32_t)slot * p_kv->config.record_size;
+}
+
+static driver_status_t static_read_slot(at24cxx_kv_t *p_kv, uint16_t slot, uint8_t *p_record)
+{
+    return at24cxx_read(p_kv->p_dev, static_slot_address(p_kv, slot),
+                        p_record, p_kv->config.record_size);
+}
+
+static driver_status_t static_scan(at24cxx_kv_t *p_kv)
+{
+    uint8_t page_buf[AT24CXX_MAX_PAGE_SIZE];
+    uint16_t page_size = p_kv->p_dev->config.page_size;
+    uint8_t record_size = p_kv->config.record_size;
+    uint16_t records_per_page = page_size / record_size;
+    uint16_t page_count = (uint16_t)(p_kv->config.region_size / page_size);
+    uint16_t page;
+    uint16_t page_slot;
+    uint16_t slot;
+    uint16_t newest_slot;
+    uint16_t distance;
+    uint32_t newest_seq;
+    uint32_t seq;
+    uint16_t pass;
+    uint16_t i;
+    const uint8_t *p_record;
+    bool found;
+    driver_status_t status;
+
+    for (i = 0; i < p_kv->max_keys; i++) {
+        p_kv->p_index[i] = AT24CXX_KV_INVALID_SLOT;
+    }
+
+    found = false;
+    newest_seq = 0;
+    newest_slot = 0;
+
+    /*
+     * 第1遍: 找到序号最大的记录, 其后一个槽即为写入头.
+     * 第2遍: 从写入头开始按从旧到新的顺序回放, 后出现的记录覆盖先出现的.
+     */
+    for (pass = 0; pass < 2; pass++) {
+        if (pass == 1 && !found) {
+            break;
+        }
+
+        for (i = 0; i < page_count; i++) {
+            page = pass == 0 ? i :
+                   (uint16_t)(((p_kv->head / records_per_page) + i) % page_count);
+
+            status = at24cxx_read(p_kv->p_dev,
+                                  p_kv->config.base_address + (uint32_t)page * page_size,
+                                  page_buf, page_size);
+            if (status != DRV_OK) {
+                return status;
+            }
+
+            for (page_slot = 0; page_slot < records_per_page; page_slot++) {
+                slot = (uint16_t)(page * records_per_page + page_slot);
+                p_record = &page_buf[page_slot * record_size];
+
+                if (!static_record_valid(p_kv, p_record)) {
+                    continue;
+                }
+
+                if (pass == 0) {
+                    seq = DRV_MAKE_U32(p_record[KV_OFFSET_SEQ], p_record[KV_OFFSET_SEQ + 1],
+                                       p_record[KV_OFFSET_SEQ + 2], p_record[KV_OFFSET_SEQ + 3]);
+                    if (!found || KV_SEQ_NEWER(seq, newest_seq)) {
+                        newest_seq = seq;
+                        newest_slot = slot;
+                        found = true;
+                    }
+                    continue;
+                }
+
+                /* 写入头所在页中位于写入头之前的槽属于最新一圈, 最后回放 */
+                if (i == 0 && slot < p_kv->head) {
+                    continue;
+                }
+
+                if (p_record[KV_OFFSET_KEY] < p_kv->max_keys) {
+                    p_kv->p_index[p_record[KV_OFFSET_KEY]] =
+                        (p_record[KV_OFFSET_FLAGS] & KV_FLAG_TOMBSTONE) ? AT24CXX_KV_INVALID_SLOT : slot;
+                }
+            }
+        }
+
+        if (pass == 0) {
+            p_kv->head = found ? (uint16_t)((newest_slot + 1) % p_kv->slot_count) : 0;
+            p_kv->next_seq = found ? newest_seq + 1 : 1;
+        } else if (p_kv->head % records_per_page != 0) {
+            /* 补回写入头所在页中位于写入头之前的槽 */
+            page = p_kv->head / records_per_page;
+            status = at24cxx_read(p_kv->p_dev,
+                                  p_kv->config.base_address + (uint32_t)page * page_size,
+                                  page_buf, page_size);
+            if (status != DRV_OK) {
+                return status;
+            }
+
+            for (slot = (uint16_t)(page * records_per_page); slot < p_kv->head; slot++) {
+                p_record = &page_buf[(slot % records_per_page) * record_size];
+                if (static_record_valid(p_kv, p_record) && p_record[KV_OFFSET_KEY] < p_kv->max_keys) {
+                    p_kv->p_index[p_record[KV_OFFSET_KEY]] =
+                        (p_record[KV_OFFSET_FLAGS] & KV_FLAG_TOMBSTONE) ? AT24CXX_KV_INVALID_SLOT : slot;
+                }
+            }
+        }
+    }
+
+    p_kv->stats.live_count = 0;
+    for (i = 0; i < p_kv->max_keys; i++) {
+        if (p_kv->p_index[i] != AT24CXX_KV_INVALID_SLOT) {
+            p_kv->stats.live_count++;
+        }
+    }
+
+    /* 最旧的已用槽 = 距写入头最近的有效记录 (从写入头向前计) */
+    p_kv->stats.slot_count = p_kv->slot_count;
+    p_kv->stats.free_slots = p_kv->slot_count;
+    p_kv->tail = p_kv->head;
+
+    for (i = 0; i < p_kv->max_keys; i++) {
+        slot = p_kv->p_index[i];
+        if (slot == AT24CXX_KV_INVALID_SLOT) {
+            continue;
+        }
+
+        distance = (uint16_t)((slot + p_kv->slot_count - p_kv->head) % p_kv->slot_count);
+        if (distance < p_kv->stats.free_slots) {
+            p_kv->stats.free_slots = distance;
+            p_kv->tail = slot;
+        }
+    }
+
+    return DRV_OK;
+}
+
+static driver_status_t static_append(at24cxx_kv_t *p_kv, uint8_t key, uint8_t flags,
+                                     const uint8_t *p_value, uint8_t length)
+{
+    driver_status_t status;
+
+    if (p_kv->p_index[key] == AT24CXX_KV_INVALID_SLOT && (flags & KV_FLAG_TOMBSTONE) == 0 &&
+        p_kv->stats.live_count + 1U + p_kv->config.gc_reserve > p_kv->slot_count) {
+        return DRV_ERR_NO_MEM;
+    }
+
+    if (p_kv->stats.free_slots < p_kv->config.gc_reserve) {
+        status = at24cxx_kv_gc(p_kv, p_kv->config.gc_reserve);
+        if (status != DRV_OK) {
+            return status;
+        }
+    }
+
+    return static_write_record(p_kv, key, flags, p_value, length);
+}
+
+static driver_status_t static_write_record(at24cxx_kv_t *p_kv, uint8_t key, uint8_t flags,
+                                           const uint8_t *p_value, uint8_t length)
+{
+    uint8_t record[AT24CXX_KV_MAX_RECORD_SIZE];
+    uint8_t record_size = p_kv->config.record_size;
+    bool is_new_key;
+    bool is_tombstone;
+    driver_status_t status;
+
+    is_new_key = p_kv->p_index[key] == AT24CXX_KV_INVALID_SLOT;
+    is_tombstone = (flags & KV_FLAG_TOMBSTONE) != 0;
+
+    memset(record, 0xFF, record_size);
+    record[KV_OFFSET_MAGIC] = KV_RECORD_MAGIC;
+    record[KV_OFFSET_KEY] = key;
+    record[KV_OFFSET_LENGTH] = length;
+    record[KV_OFFSET_FLAGS] = flags;
+    record[KV_OFFSET_SEQ] = DRV_U32_BYTE0(p_kv->next_seq);
+    record[KV_OFFSET_SEQ + 1] = DRV_U32_BYTE1(p_kv->next_seq);
+    record[KV_OFFSET_SEQ + 2] = DRV_U32_BYTE2(p_kv->next_seq);
+    record[KV_OFFSET_SEQ + 3] = DRV_U32_BYTE3(p_kv->next_seq);
+    if (length != 0) {
+        memcpy(&record[KV_OFFSET_VALUE], p_value, length);
+    }
+
+    driver_crc16_ccitt_append(record, record_size - 2U);
+
+    status = at24cxx_write(p_kv->p_dev, static_slot_address(p_kv, p_kv->head), record, record_size);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    if (is_tombstone) {
+        p_kv->p_index[key] = AT24CXX_KV_INVALID_SLOT;
+        p_kv->stats.live_count--;
+    } else {
+        p_kv->p_index[key] = p_kv->head;
+        if (is_new_key) {
+            p_kv->stats.live_count++;
+        }
+    }
+
+    p_kv->head = (uint16_t)((p_kv->head + 1) % p_kv->slot_count);
+    p_kv->stats.free_slots--;
+    p_kv->stats.append_count++;
+    p_kv->next_seq++;
+
+    return DRV_OK;
+}
+
+static driver_status_t static_gc_step(at24cxx_kv_t *p_kv)
+{
+    uint8_t record[AT24CXX_KV_MAX_RECORD_SIZE];
+    uint16_t slot = p_kv->tail;
+    uint8_t key;
+    driver_status_t status;
+
+    if (p_kv->stats.free_slots >= p_kv->slot_count) {
+        return DRV_OK;
+    }
+
+    status = static_read_slot(p_kv, slot, record);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    key = record[KV_OFFSET_KEY];
+
+    /* 最旧的槽仍是某个键的最新值: 先复制到写入头, 再释放该槽 */
+    if (static_record_valid(p_kv, record) && key < p_kv->max_keys && p_kv->p_index[key] == slot) {
+        if (p_kv->stats.free_slots == 0) {
+            return DRV_ERR_NO_MEM;
+        }
+
+        status = static_write_record(p_kv, key, 0, &record[KV_OFFSET_VALUE], record[KV_OFFSET_LENGTH]);
+        if (status != DRV_OK) {
+            return status;
+        }
+
+        p_kv->stats.gc_move_count++;
+    }
+
+    p_kv->tail = (uint16_t)((p_kv->tail + 1) % p_kv->slot_count);
+    p_kv->stats.free_slots++;
+
+    return DRV_OK;
+}
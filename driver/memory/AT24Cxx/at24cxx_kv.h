@@ -0,0 +1,149 @@
+/**
+ * @file at24cxx_kv.h
+ * @brief AT24Cxx 日志结构键值存储 (Log-structured Key-Value Store)
+ * @note  记录以固定大小的槽循环追加到日志区, 每条记录带序号与CRC;
+ *        RAM索引 (key -> 槽号) 在初始化时扫描重建, 查询为 O(1).
+ *        写入为一次页内追加, 磨损均匀分布在整个日志区.
+ */
+
+#ifndef AT24CXX_KV_H
+#define AT24CXX_KV_H
+
+#include "at24cxx_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#define AT24CXX_KV_MAX_RECORD_SIZE  64U       /**< 支持的最大记录槽大小 */
+#define AT24CXX_KV_RECORD_OVERHEAD  10U       /**< 每条记录的头部与CRC开销 */
+#define AT24CXX_KV_INVALID_SLOT     0xFFFFU   /**< 索引项: 键不存在 */
+
+/** 指定记录槽大小时单条记录可容纳的最大值长度 */
+#define AT24CXX_KV_VALUE_CAPACITY(record_size) ((record_size) - AT24CXX_KV_RECORD_OVERHEAD)
+
+/* --- 2. 配置与对象 (Configuration & Object) --- */
+
+/**
+ * @brief 键值存储配置
+ */
+typedef struct {
+    uint32_t base_address;   /**< 日志区起始地址 (页对齐) */
+    uint32_t region_size;    /**< 日志区大小 (页大小的整数倍) */
+    uint8_t  record_size;    /**< 记录槽大小 (2的幂, 16 ~ 64, 且不大于页大小) */
+    uint16_t gc_reserve;     /**< 空闲槽低水位, 低于该值时自动回收 (最小2, 0使用默认值2) */
+} at24cxx_kv_config_t;
+
+/**
+ * @brief 键值存储统计
+ */
+typedef struct {
+    uint16_t slot_count;     /**< 记录槽总数 */
+    uint16_t free_slots;     /**< 空闲槽数量 */
+    uint16_t live_count;     /**< 有效键数量 */
+    uint32_t append_count;   /**< 累计追加记录次数 (含回收搬移) */
+    uint32_t gc_move_count;  /**< 回收时搬移的有效记录数 */
+} at24cxx_kv_stats_t;
+
+/**
+ * @brief 键值存储对象
+ */
+typedef struct {
+    at24cxx_dev_t *p_dev;          /**< 底层EEPROM设备 */
+    at24cxx_kv_config_t config;    /**< 配置副本 */
+    uint16_t *p_index;             /**< 键索引 (调用者提供, max_keys 项) */
+    uint16_t max_keys;             /**< 键数量上限 (键取值 0 ~ max_keys-1) */
+    uint16_t slot_count;           /**< 记录槽总数 */
+    uint16_t head;                 /**< 下一条记录写入的槽 */
+    uint16_t tail;                 /**< 最旧的已用槽 */
+    uint32_t next_seq;             /**< 下一条记录的序号 */
+    at24cxx_kv_stats_t stats;      /**< 统计信息 */
+    bool is_initialized;           /**< 初始化标志 */
+} at24cxx_kv_t;
+
+/* --- 3. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 初始化键值存储并扫描日志区重建索引
+ * @param p_kv 键值存储对象指针
+ * @param p_dev 已初始化的EEPROM设备
+ * @param p_config 配置
+ * @param p_index 索引数组 (max_keys 项, 调用者分配)
+ * @param max_keys 键数量上限 (1 ~ 256)
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_kv_init(at24cxx_kv_t *p_kv,
+                                at24cxx_dev_t *p_dev,
+                                const at24cxx_kv_config_t *p_config,
+                                uint16_t *p_index,
+                                uint16_t max_keys);
+
+/**
+ * @brief 读取键值
+ * @param p_kv 键值存储对象指针
+ * @param key 键
+ * @param p_value 输出缓冲区
+ * @param buf_size 输出缓冲区大小
+ * @param p_length 输出值长度 (可为NULL)
+ * @return driver_status_t
+ * @retval DRV_ERR_COMMON 键不存在
+ * @retval DRV_ERR_NO_MEM 缓冲区不足
+ */
+driver_status_t at24cxx_kv_get(at24cxx_kv_t *p_kv,
+                               uint8_t key,
+                               uint8_t *p_value,
+                               uint8_t buf_size,
+                               uint8_t *p_length);
+
+/**
+ * @brief 写入键值 (追加一条新记录, 值未变化时不写入)
+ * @param p_kv 键值存储对象指针
+ * @param key 键
+ * @param p_value 值
+ * @param length 值长度 (不超过 AT24CXX_KV_VALUE_CAPACITY(record_size))
+ * @return driver_status_t
+ * @retval DRV_ERR_NO_MEM 日志区已满 (有效键过多)
+ */
+driver_status_t at24cxx_kv_set(at24cxx_kv_t *p_kv,
+                               uint8_t key,
+                               const uint8_t *p_value,
+                               uint8_t length);
+
+/**
+ * @brief 删除键 (追加一条删除标记)
+ * @param p_kv 键值存储对象指针
+ * @param key 键
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_kv_delete(at24cxx_kv_t *p_kv, uint8_t key);
+
+/**
+ * @brief 手动回收: 回收最旧的槽直到空闲槽不少于 min_free
+ * @param p_kv 键值存储对象指针
+ * @param min_free 目标空闲槽数量
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_kv_gc(at24cxx_kv_t *p_kv, uint16_t min_free);
+
+/**
+ * @brief 格式化日志区 (擦除全部记录)
+ * @param p_kv 键值存储对象指针
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_kv_format(at24cxx_kv_t *p_kv);
+
+/**
+ * @brief 获取统计信息
+ * @param p_kv 键值存储对象指针
+ * @param p_stats 输出统计信息
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_kv_get_stats(at24cxx_kv_t *p_kv, at24cxx_kv_stats_t *p_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT24CXX_KV_H */
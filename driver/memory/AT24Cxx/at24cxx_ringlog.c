@@ -0,0 +1,364 @@
+#include "at24cxx_ringlog.h"
+#include "../../../core/driver_crc.h"
+#include <string.h>
+
+/* --- 1. 私有宏定义 (Private Macros) --- */
+
+/*
+ * 记录布局 (record_size 字节):
+ * [0..3] 序号(大端)  [4 .. record_size-2) 载荷
+ * [record_size-2 .. record_size-1] CRC-16/CCITT (覆盖之前所有字节)
+ *
+ * 槽 i 中记录的序号总是比槽 i-1 大 1 (槽 0 接在最后一个槽之后),
+ * 因此以槽 0 的序号 s0 为基准, "槽 i 有效且序号为 s0+i" 对当前一圈
+ * 的前缀成立、对其后的旧记录或空槽不成立, 可直接二分查找写入头.
+ */
+#define RINGLOG_OFFSET_SEQ       0
+#define RINGLOG_OFFSET_PAYLOAD   4
+#define RINGLOG_MIN_RECORD_SIZE  8U
+
+/* --- 2. 私有函数声明 (Private Functions) --- */
+
+static bool static_record_valid(const at24cxx_ringlog_t *p_log, const uint8_t *p_record);
+static uint32_t static_record_seq(const uint8_t *p_record);
+static uint32_t static_slot_address(const at24cxx_ringlog_t *p_log, uint16_t slot);
+static driver_status_t static_probe_slot(at24cxx_ringlog_t *p_log, uint16_t slot,
+                                         bool *p_valid, uint32_t *p_seq);
+static driver_status_t static_recover(at24cxx_ringlog_t *p_log);
+static driver_status_t static_read_span(at24cxx_ringlog_t *p_log, uint16_t slot,
+                                        uint16_t count, uint8_t *p_buf);
+
+/* --- 3. 公共函数实现 (Public Functions) --- */
+
+driver_status_t at24cxx_ringlog_init(at24cxx_ringlog_t *p_log,
+                                     at24cxx_dev_t *p_dev,
+                                     const at24cxx_ringlog_config_t *p_config,
+                                     uint8_t *p_page_buf)
+{
+    uint16_t page_size;
+    uint8_t record_size;
+    uint32_t slot_count;
+    driver_status_t status;
+
+    if (p_log == NULL || p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_config == NULL || p_page_buf == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    page_size = p_dev->config.page_size;
+    record_size = p_config->record_size;
+
+    /* 记录必须整除页大小, 一页内的记录可以合并为一次页写入 */
+    if (record_size < RINGLOG_MIN_RECORD_SIZE || (record_size & (record_size - 1)) != 0 ||
+        record_size > page_size) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if ((p_config->base_address % page_size) != 0 || p_config->region_size == 0 ||
+        (p_config->region_size % page_size) != 0 ||
+        p_config->base_address >= p_dev->config.capacity ||
+        p_config->region_size > p_dev->config.capacity - p_config->base_address) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    slot_count = p_config->region_size / record_size;
+    if (slot_count < 2 || slot_count > 0xFFFFU) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    memset(p_log, 0, sizeof(at24cxx_ringlog_t));
+
+    p_log->p_dev = p_dev;
+    p_log->config = *p_config;
+    p_log->p_page_buf = p_page_buf;
+    p_log->slot_count = (uint16_t)slot_count;
+    p_log->records_per_page = page_size / record_size;
+
+    status = static_recover(p_log);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    p_log->is_initialized = true;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_ringlog_append(at24cxx_ringlog_t *p_log, const uint8_t *p_payload)
+{
+    uint8_t *p_record;
+    uint8_t record_size;
+
+    if (p_log == NULL || !p_log->is_initialized || p_payload == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    record_size = p_log->config.record_size;
+
+    /* 日志已满: 新记录将覆盖最旧的记录 */
+    if (p_log->stored_count + p_log->pending_count >= p_log->slot_count) {
+        p_log->stored_count--;
+        if (p_log->unread_count > p_log->stored_count) {
+            p_log->unread_count--;
+            p_log->read_slot = (uint16_t)((p_log->read_slot + 1) % p_log->slot_count);
+            p_log->lost_count++;
+        }
+    }
+
+    p_record = p_log->p_page_buf + (p_log->head_slot % p_log->records_per_page) * record_size;
+
+    p_record[RINGLOG_OFFSET_SEQ] = DRV_U32_BYTE0(p_log->next_seq);
+    p_record[RINGLOG_OFFSET_SEQ + 1] = DRV_U32_BYTE1(p_log->next_seq);
+    p_record[RINGLOG_OFFSET_SEQ + 2] = DRV_U32_BYTE2(p_log->next_seq);
+    p_record[RINGLOG_OFFSET_SEQ + 3] = DRV_U32_BYTE3(p_log->next_seq);
+    memcpy(p_record + RINGLOG_OFFSET_PAYLOAD, p_payload, AT24CXX_RINGLOG_PAYLOAD_SIZE(record_size));
+
+    driver_crc16_ccitt_append(p_record, record_size - 2U);
+
+    p_log->next_seq++;
+    p_log->head_slot = (uint16_t)((p_log->head_slot + 1) % p_log->slot_count);
+    p_log->pending_count++;
+
+    /* 写满一页: 该页所有待写记录合并为一次页写入 */
+    if ((p_log->head_slot % p_log->records_per_page) == 0) {
+        return at24cxx_ringlog_flush(p_log);
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_ringlog_flush(at24cxx_ringlog_t *p_log)
+{
+    uint16_t first_slot;
+    uint16_t offset;
+    uint8_t record_size;
+    driver_status_t status;
+
+    if (p_log == NULL || !p_log->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_log->pending_count == 0) {
+        return DRV_OK;
+    }
+
+    record_size = p_log->config.record_size;
+
+    /* 待写记录总在同一页内, 且位于写入头之前 */
+    first_slot = (uint16_t)((p_log->head_slot + p_log->slot_count - p_log->pending_count) %
+                            p_log->slot_count);
+    offset = (first_slot % p_log->records_per_page) * record_size;
+
+    status = at24cxx_write(p_log->p_dev,
+                           static_slot_address(p_log, first_slot),
+                           p_log->p_page_buf + offset,
+                           p_log->pending_count * record_size);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    p_log->stored_count += p_log->pending_count;
+    p_log->unread_count += p_log->pending_count;
+    p_log->pending_count = 0;
+
+    return DRV_OK;
+}
+
+uint16_t at24cxx_ringlog_available(at24cxx_ringlog_t *p_log)
+{
+    if (p_log == NULL || !p_log->is_initialized) {
+        return 0;
+    }
+
+    return p_log->unread_count;
+}
+
+driver_status_t at24cxx_ringlog_read(at24cxx_ringlog_t *p_log,
+                                     uint8_t *p_buf,
+                                     uint16_t buf_size,
+                                     uint16_t *p_count)
+{
+    uint8_t record_size;
+    uint8_t payload_size;
+    uint16_t count;
+    uint16_t first;
+    uint16_t i;
+    uint16_t out;
+    uint32_t expect_seq;
+    const uint8_t *p_record;
+    driver_status_t status;
+
+    if (p_log == NULL || !p_log->is_initialized || p_buf == NULL || p_count == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    *p_count = 0;
+
+    record_size = p_log->config.record_size;
+    payload_size = AT24CXX_RINGLOG_PAYLOAD_SIZE(record_size);
+
+    count = buf_size / record_size;
+    if (count > p_log->unread_count) {
+        count = p_log->unread_count;
+    }
+
+    if (count == 0) {
+        return DRV_OK;
+    }
+
+    /* 连续的槽一次读出, 跨越日志区末尾时拆为两次 */
+    first = p_log->slot_count - p_log->read_slot;
+    if (first > count) {
+        first = count;
+    }
+
+    status = static_read_span(p_log, p_log->read_slot, first, p_buf);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    if (count > first) {
+        status = static_read_span(p_log, 0, count - first, p_buf + first * record_size);
+        if (status != DRV_OK) {
+            return status;
+        }
+    }
+
+    /* 最旧未读记录的序号: 写入头之前还有 pending + unread 条记录 */
+    expect_seq = p_log->next_seq - p_log->pending_count - p_log->unread_count;
+
+    /* 就地压缩: 仅保留载荷, 输出位置总不超过输入位置 */
+    out = 0;
+    for (i = 0; i < count; i++) {
+        p_record = p_buf + i * record_size;
+
+        if (static_record_valid(p_log, p_record) &&
+            static_record_seq(p_record) == expect_seq + i) {
+            memmove(p_buf + out * payload_size, p_record + RINGLOG_OFFSET_PAYLOAD, payload_size);
+            out++;
+        } else {
+            p_log->lost_count++;
+        }
+    }
+
+    p_log->read_slot = (uint16_t)((p_log->read_slot + count) % p_log->slot_count);
+    p_log->unread_count -= count;
+    *p_count = out;
+
+    return DRV_OK;
+}
+
+/* --- 4. 私有函数实现 (Private Functions) --- */
+
+static bool static_record_valid(const at24cxx_ringlog_t *p_log, const uint8_t *p_record)
+{
+    return driver_crc16_ccitt_check(p_record, p_log->config.record_size - 2U);
+}
+
+static uint32_t static_record_seq(const uint8_t *p_record)
+{
+    return DRV_MAKE_U32(p_record[RINGLOG_OFFSET_SEQ], p_record[RINGLOG_OFFSET_SEQ + 1],
+                        p_record[RINGLOG_OFFSET_SEQ + 2], p_record[RINGLOG_OFFSET_SEQ + 3]);
+}
+
+static uint32_t static_slot_address(const at24cxx_ringlog_t *p_log, uint16_t slot)
+{
+    return p_log->config.base_address + (uint32_t)slot * p_log->config.record_size;
+}
+
+static driver_status_t static_probe_slot(at24cxx_ringlog_t *p_log, uint16_t slot,
+                                         bool *p_valid, uint32_t *p_seq)
+{
+    uint8_t *p_record = p_log->p_page_buf;
+    driver_status_t status;
+
+    status = at24cxx_read(p_log->p_dev, static_slot_address(p_log, slot),
+                          p_record, p_log->config.record_size);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    p_log->recovery_read_count++;
+
+    *p_valid = static_record_valid(p_log, p_record);
+    *p_seq = *p_valid ? static_record_seq(p_record) : 0;
+
+    return DRV_OK;
+}
+
+static driver_status_t static_recover(at24cxx_ringlog_t *p_log)
+{
+    uint16_t n = p_log->slot_count;
+    uint32_t seq0;
+    uint32_t seq;
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t mid;
+    bool valid;
+    driver_status_t status;
+
+    status = static_probe_slot(p_log, 0, &valid, &seq0);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    if (!valid) {
+        /* 槽0无效: 要么日志为空, 要么新一圈写槽0时掉电, 此时最后一个槽仍有效 */
+        status = static_probe_slot(p_log, n - 1, &valid, &seq);
+        if (status != DRV_OK) {
+            return status;
+        }
+
+        p_log->head_slot = 0;
+        p_log->next_seq = valid ? seq + 1 : 0;
+        p_log->stored_count = valid ? n - 1 : 0;
+    } else {
+        /* 找到第一个不满足 "有效且序号为 seq0+i" 的槽 i, 即写入头 */
+        lo = 1;
+        hi = n;
+        while (lo < hi) {
+            mid = lo + (hi - lo) / 2;
+
+            status = static_probe_slot(p_log, (uint16_t)mid, &valid, &seq);
+            if (status != DRV_OK) {
+                return status;
+            }
+
+            if (valid && seq == seq0 + mid) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+
+        p_log->head_slot = (uint16_t)(lo % n);
+        p_log->next_seq = seq0 + lo;
+
+        if (lo == n) {
+            p_log->stored_count = n;
+        } else {
+            /* 最后一个槽是上一圈的记录说明已回绕, 否则只有当前一圈的记录 */
+            status = static_probe_slot(p_log, n - 1, &valid, &seq);
+            if (status != DRV_OK) {
+                return status;
+            }
+
+            p_log->stored_count = (valid && seq == seq0 - 1) ? n : (uint16_t)lo;
+        }
+    }
+
+    p_log->unread_count = p_log->stored_count;
+    p_log->read_slot = (uint16_t)((p_log->head_slot + n - p_log->stored_count) % n);
+
+    return DRV_OK;
+}
+
+static driver_status_t static_read_span(at24cxx_ringlog_t *p_log, uint16_t slot,
+                                        uint16_t count, uint8_t *p_buf)
+{
+    return at24cxx_read(p_log->p_dev, static_slot_address(p_log, slot),
+                        p_buf, count * p_log->config.record_size);
+}
@@ -0,0 +1,113 @@
+/**
+ * @file at24cxx_ringlog.h
+ * @brief AT24Cxx 环形采样日志 (Circular Sample Log)
+ * @note  固定大小的记录按槽顺序循环写入, 每条记录带连续递增的序号与CRC.
+ *        由于槽 i 与槽 i+1 的序号总是相差 1, 上电时可用二分查找在
+ *        O(log n) 次记录读取内定位写入头, 无需扫描整个芯片.
+ */
+
+#ifndef AT24CXX_RINGLOG_H
+#define AT24CXX_RINGLOG_H
+
+#include "at24cxx_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#define AT24CXX_RINGLOG_RECORD_OVERHEAD  6U   /**< 每条记录的序号与CRC开销 */
+
+/** 指定记录大小时每条记录的有效载荷长度 */
+#define AT24CXX_RINGLOG_PAYLOAD_SIZE(record_size) ((record_size) - AT24CXX_RINGLOG_RECORD_OVERHEAD)
+
+/* --- 2. 配置与对象 (Configuration & Object) --- */
+
+/**
+ * @brief 环形日志配置
+ */
+typedef struct {
+    uint32_t base_address;   /**< 日志区起始地址 (页对齐) */
+    uint32_t region_size;    /**< 日志区大小 (页大小的整数倍) */
+    uint8_t  record_size;    /**< 记录大小 (2的幂, 8 ~ 页大小), 含6字节开销 */
+} at24cxx_ringlog_config_t;
+
+/**
+ * @brief 环形日志对象
+ */
+typedef struct {
+    at24cxx_dev_t *p_dev;               /**< 底层EEPROM设备 */
+    at24cxx_ringlog_config_t config;    /**< 配置副本 */
+    uint8_t *p_page_buf;                /**< 页批量缓冲区 (调用者提供, 页大小) */
+    uint16_t slot_count;                /**< 记录槽总数 */
+    uint16_t records_per_page;          /**< 每页记录数 */
+    uint16_t head_slot;                 /**< 下一条记录写入的槽 */
+    uint16_t pending_count;             /**< 缓冲区中尚未写入的记录数 */
+    uint16_t stored_count;              /**< 已写入EEPROM的记录数 */
+    uint16_t read_slot;                 /**< 下一条待读取记录的槽 */
+    uint16_t unread_count;              /**< 已写入但未读取的记录数 */
+    uint32_t next_seq;                  /**< 下一条记录的序号 */
+    uint32_t lost_count;                /**< 未读取即被覆盖的记录数 */
+    uint16_t recovery_read_count;       /**< 上电定位写入头所用的读取次数 */
+    bool is_initialized;                /**< 初始化标志 */
+} at24cxx_ringlog_t;
+
+/* --- 3. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 初始化环形日志并定位写入头 (二分查找)
+ * @param p_log 日志对象指针
+ * @param p_dev 已初始化的EEPROM设备
+ * @param p_config 配置
+ * @param p_page_buf 页批量缓冲区 (页大小, 调用者分配)
+ * @return driver_status_t
+ * @note  上电后所有已存储的记录均视为未读
+ */
+driver_status_t at24cxx_ringlog_init(at24cxx_ringlog_t *p_log,
+                                     at24cxx_dev_t *p_dev,
+                                     const at24cxx_ringlog_config_t *p_config,
+                                     uint8_t *p_page_buf);
+
+/**
+ * @brief 追加一条记录 (写满一页时自动以一次页写入落盘)
+ * @param p_log 日志对象指针
+ * @param p_payload 载荷 (长度为 AT24CXX_RINGLOG_PAYLOAD_SIZE(record_size))
+ * @return driver_status_t
+ * @note  日志满时覆盖最旧的记录
+ */
+driver_status_t at24cxx_ringlog_append(at24cxx_ringlog_t *p_log, const uint8_t *p_payload);
+
+/**
+ * @brief 将缓冲区中尚未写入的记录落盘
+ * @param p_log 日志对象指针
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_ringlog_flush(at24cxx_ringlog_t *p_log);
+
+/**
+ * @brief 获取可读取的记录数 (仅包含已落盘的记录)
+ * @param p_log 日志对象指针
+ * @return 记录数
+ */
+uint16_t at24cxx_ringlog_available(at24cxx_ringlog_t *p_log);
+
+/**
+ * @brief 按从旧到新的顺序读取记录载荷
+ * @param p_log 日志对象指针
+ * @param p_buf 输出缓冲区, 载荷依次紧密排列
+ * @param buf_size 缓冲区大小, 每条记录需要 record_size 字节的工作空间
+ * @param p_count 输出读取到的记录数
+ * @return driver_status_t
+ * @note  以最多两次连续读取 (跨越日志区末尾时) 取回全部记录; CRC或序号不符的记录被丢弃并计入 lost_count
+ */
+driver_status_t at24cxx_ringlog_read(at24cxx_ringlog_t *p_log,
+                                     uint8_t *p_buf,
+                                     uint16_t buf_size,
+                                     uint16_t *p_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT24CXX_RINGLOG_H */
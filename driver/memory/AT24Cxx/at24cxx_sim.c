@@ -0,0 +1,333 @@
+#include "at24cxx_sim.h"
+#include <string.h>
+
+/* --- 1. 私有宏定义 (Private Macros) --- */
+
+#define SIM_BITS_PER_BYTE       9U      /**< 8位数据 + ACK */
+#define SIM_BITS_START_STOP     2U      /**< 起始与停止条件 (按各一个位时间计) */
+#define SIM_MAX_BLOCK_COUNT     8U      /**< 设备地址中最多3个块选择位 */
+
+/* --- 2. 私有函数声明 (Private Functions) --- */
+
+static driver_status_t static_transfer(at24cxx_sim_t *p_sim,
+                                       uint8_t dev_addr,
+                                       const uint8_t *p_head,
+                                       uint32_t head_len,
+                                       const uint8_t *p_tx,
+                                       uint32_t tx_len,
+                                       uint8_t *p_rx,
+                                       uint32_t rx_len);
+static void static_bus_time(at24cxx_sim_t *p_sim, uint32_t bits);
+static void static_commit_page(at24cxx_sim_t *p_sim,
+                               const uint8_t *p_head,
+                               uint32_t head_len,
+                               const uint8_t *p_tx,
+                               uint32_t tx_len);
+static driver_status_t static_write_reg(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                        const uint8_t *p_data, uint32_t len);
+static driver_status_t static_read_reg(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                       uint8_t *p_data, uint32_t len);
+static driver_status_t static_write_read(void *ctx, uint8_t dev_addr, const uint8_t *p_tx, uint32_t tx_len,
+                                         uint8_t *p_rx, uint32_t rx_len);
+static driver_status_t static_write_reg_async(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                              const uint8_t *p_data, uint32_t len,
+                                              driver_completion_callback_t cb, void *user_data);
+static driver_status_t static_read_reg_async(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                             uint8_t *p_data, uint32_t len,
+                                             driver_completion_callback_t cb, void *user_data);
+static driver_status_t static_write_read_async(void *ctx, uint8_t dev_addr, const uint8_t *p_tx, uint32_t tx_len,
+                                               uint8_t *p_rx, uint32_t rx_len,
+                                               driver_completion_callback_t cb, void *user_data);
+
+/* --- 3. 公共函数实现 (Public Functions) --- */
+
+driver_status_t at24cxx_sim_init(at24cxx_sim_t *p_sim,
+                                 const at24cxx_sim_config_t *p_config,
+                                 at24cxx_sim_clock_t *p_clock,
+                                 uint8_t *p_mem,
+                                 uint32_t *p_wear)
+{
+    uint32_t block_count;
+
+    if (p_sim == NULL || p_config == NULL || p_clock == NULL || p_mem == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_config->page_size == 0 || p_config->capacity == 0 || p_config->bus_hz == 0 ||
+        (p_config->capacity % p_config->page_size) != 0 ||
+        (p_config->addr_bytes != 1 && p_config->addr_bytes != 2)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    /* 地址字节无法容纳的高位通过设备地址的块选择位寻址 */
+    block_count = (p_config->capacity + (1UL << (8U * p_config->addr_bytes)) - 1U) >>
+                  (8U * p_config->addr_bytes);
+    if (block_count > SIM_MAX_BLOCK_COUNT) {
+        return DRV_ERR_NOT_SUPPORT;
+    }
+
+    memset(p_sim, 0, sizeof(at24cxx_sim_t));
+
+    p_sim->config = *p_config;
+    p_sim->p_clock = p_clock;
+    p_sim->p_mem = p_mem;
+    p_sim->p_wear = p_wear;
+    p_sim->block_mask = (uint8_t)(block_count - 1U);
+    p_sim->is_powered = true;
+
+    memset(p_mem, 0xFF, p_config->capacity);
+    if (p_wear != NULL) {
+        memset(p_wear, 0, p_config->capacity * sizeof(uint32_t));
+    }
+
+    p_sim->is_initialized = true;
+
+    return DRV_OK;
+}
+
+void at24cxx_sim_get_i2c_ops(driver_i2c_ops_t *p_ops)
+{
+    if (p_ops == NULL) {
+        return;
+    }
+
+    memset(p_ops, 0, sizeof(driver_i2c_ops_t));
+
+    p_ops->write_reg = static_write_reg;
+    p_ops->write_reg_async = static_write_reg_async;
+    p_ops->read_reg = static_read_reg;
+    p_ops->read_reg_async = static_read_reg_async;
+    p_ops->write_read = static_write_read;
+    p_ops->write_read_async = static_write_read_async;
+}
+
+driver_status_t at24cxx_sim_inject_power_loss(at24cxx_sim_t *p_sim, uint32_t committed_bytes)
+{
+    if (p_sim == NULL || !p_sim->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_sim->power_fail_bytes = committed_bytes;
+    p_sim->power_fail_armed = true;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_sim_power_on(at24cxx_sim_t *p_sim)
+{
+    if (p_sim == NULL || !p_sim->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_sim->is_powered = true;
+    p_sim->busy_until_ns = 0;
+    p_sim->address_pointer = 0;
+    p_sim->power_fail_armed = false;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_sim_get_stats(at24cxx_sim_t *p_sim, at24cxx_sim_stats_t *p_stats)
+{
+    if (p_sim == NULL || !p_sim->is_initialized || p_stats == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    *p_stats = p_sim->stats;
+
+    return DRV_OK;
+}
+
+void at24cxx_sim_clock_advance_us(at24cxx_sim_clock_t *p_clock, uint32_t us)
+{
+    if (p_clock != NULL) {
+        p_clock->now_ns += (uint64_t)us * 1000U;
+    }
+}
+
+uint32_t at24cxx_sim_clock_get_ms(const at24cxx_sim_clock_t *p_clock)
+{
+    if (p_clock == NULL) {
+        return 0;
+    }
+
+    return (uint32_t)(p_clock->now_ns / 1000000U);
+}
+
+/* --- 4. 私有函数实现 (Private Functions) --- */
+
+static driver_status_t static_transfer(at24cxx_sim_t *p_sim,
+                                       uint8_t dev_addr,
+                                       const uint8_t *p_head,
+                                       uint32_t head_len,
+                                       const uint8_t *p_tx,
+                                       uint32_t tx_len,
+                                       uint8_t *p_rx,
+                                       uint32_t rx_len)
+{
+    uint32_t tx_total = head_len + tx_len;
+    uint32_t bits;
+    uint32_t i;
+
+    if (p_sim == NULL || !p_sim->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_sim->stats.transaction_count++;
+
+    /* 地址不匹配, 或断电/写周期中: 设备地址字节无应答, 主机随即发送停止条件 */
+    if ((uint8_t)(dev_addr & (uint8_t)~p_sim->block_mask) != p_sim->config.device_addr) {
+        static_bus_time(p_sim, SIM_BITS_START_STOP + SIM_BITS_PER_BYTE);
+        return DRV_ERR_IO;
+    }
+
+    if (!p_sim->is_powered || p_sim->p_clock->now_ns < p_sim->busy_until_ns) {
+        p_sim->stats.nack_count++;
+        static_bus_time(p_sim, SIM_BITS_START_STOP + SIM_BITS_PER_BYTE);
+        return DRV_ERR_IO;
+    }
+
+    bits = SIM_BITS_START_STOP + SIM_BITS_PER_BYTE * (1U + tx_total);
+    if (rx_len > 0) {
+        /* 重复起始条件 + 读方向设备地址 + 数据 */
+        bits += 1U + SIM_BITS_PER_BYTE * (1U + rx_len);
+    }
+    static_bus_time(p_sim, bits);
+
+    /* 地址阶段不完整时芯片忽略已收到的地址字节, 地址指针保持不变 */
+    if (tx_total >= p_sim->config.addr_bytes) {
+        uint8_t addr_buf[2];
+
+        for (i = 0; i < p_sim->config.addr_bytes; i++) {
+            addr_buf[i] = (i < head_len) ? p_head[i] : p_tx[i - head_len];
+        }
+
+        p_sim->address_pointer = (uint32_t)(dev_addr & p_sim->block_mask) << (8U * p_sim->config.addr_bytes);
+        p_sim->address_pointer |= (p_sim->config.addr_bytes == 1) ?
+                                  addr_buf[0] : DRV_MAKE_U16(addr_buf[0], addr_buf[1]);
+        p_sim->address_pointer %= p_sim->config.capacity;
+
+        if (tx_total > p_sim->config.addr_bytes) {
+            static_commit_page(p_sim, p_head, head_len, p_tx, tx_len);
+            return DRV_OK;
+        }
+    }
+
+    /* 顺序读取在芯片末尾回卷到地址0 */
+    for (i = 0; i < rx_len; i++) {
+        p_rx[i] = p_sim->p_mem[p_sim->address_pointer];
+        p_sim->address_pointer = (p_sim->address_pointer + 1U) % p_sim->config.capacity;
+    }
+    p_sim->stats.bytes_read += rx_len;
+
+    return DRV_OK;
+}
+
+static void static_bus_time(at24cxx_sim_t *p_sim, uint32_t bits)
+{
+    p_sim->p_clock->now_ns += (uint64_t)bits * 1000000000ULL / p_sim->config.bus_hz;
+}
+
+static void static_commit_page(at24cxx_sim_t *p_sim,
+                               const uint8_t *p_head,
+                               uint32_t head_len,
+                               const uint8_t *p_tx,
+                               uint32_t tx_len)
+{
+    uint16_t page_size = p_sim->config.page_size;
+    uint32_t page_base = p_sim->address_pointer - p_sim->address_pointer % page_size;
+    uint32_t offset = p_sim->address_pointer % page_size;
+    uint32_t data_start = p_sim->config.addr_bytes;
+    uint32_t data_len = head_len + tx_len - data_start;
+    uint32_t commit_len = data_len;
+    uint32_t cell;
+    uint32_t i;
+    uint8_t value;
+
+    if (p_sim->power_fail_armed && p_sim->power_fail_bytes < commit_len) {
+        commit_len = p_sim->power_fail_bytes;
+    }
+
+    /* 超出页尾的数据回卷到同一页的页首, 覆盖先写入的字节 */
+    for (i = 0; i < commit_len; i++) {
+        value = (data_start + i < head_len) ? p_head[data_start + i] : p_tx[data_start + i - head_len];
+        cell = page_base + (offset + i) % page_size;
+
+        p_sim->p_mem[cell] = value;
+
+        if (p_sim->p_wear != NULL) {
+            p_sim->p_wear[cell]++;
+            if (p_sim->p_wear[cell] > p_sim->stats.max_cell_writes) {
+                p_sim->stats.max_cell_writes = p_sim->p_wear[cell];
+            }
+        }
+    }
+
+    p_sim->stats.bytes_written += commit_len;
+    p_sim->stats.page_write_count++;
+    p_sim->address_pointer = page_base + (offset + data_len) % page_size;
+    p_sim->busy_until_ns = p_sim->p_clock->now_ns + (uint64_t)p_sim->config.twr_us * 1000U;
+
+    if (p_sim->power_fail_armed) {
+        p_sim->power_fail_armed = false;
+        p_sim->is_powered = false;
+    }
+}
+
+static driver_status_t static_write_reg(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                        const uint8_t *p_data, uint32_t len)
+{
+    return static_transfer((at24cxx_sim_t *)ctx, dev_addr, &reg_addr, 1, p_data, len, NULL, 0);
+}
+
+static driver_status_t static_read_reg(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                       uint8_t *p_data, uint32_t len)
+{
+    return static_transfer((at24cxx_sim_t *)ctx, dev_addr, &reg_addr, 1, NULL, 0, p_data, len);
+}
+
+static driver_status_t static_write_read(void *ctx, uint8_t dev_addr, const uint8_t *p_tx, uint32_t tx_len,
+                                         uint8_t *p_rx, uint32_t rx_len)
+{
+    return static_transfer((at24cxx_sim_t *)ctx, dev_addr, NULL, 0, p_tx, tx_len, p_rx, rx_len);
+}
+
+/* 异步接口在发起时立即完成并执行回调 (虚拟时间中传输时间已计入) */
+static driver_status_t static_write_reg_async(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                              const uint8_t *p_data, uint32_t len,
+                                              driver_completion_callback_t cb, void *user_data)
+{
+    driver_status_t status = static_write_reg(ctx, dev_addr, reg_addr, p_data, len);
+
+    if (cb != NULL) {
+        cb(user_data, status);
+    }
+
+    return DRV_OK;
+}
+
+static driver_status_t static_read_reg_async(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                             uint8_t *p_data, uint32_t len,
+                                             driver_completion_callback_t cb, void *user_data)
+{
+    driver_status_t status = static_read_reg(ctx, dev_addr, reg_addr, p_data, len);
+
+    if (cb != NULL) {
+        cb(user_data, status);
+    }
+
+    return DRV_OK;
+}
+
+static driver_status_t static_write_read_async(void *ctx, uint8_t dev_addr, const uint8_t *p_tx, uint32_t tx_len,
+                                               uint8_t *p_rx, uint32_t rx_len,
+                                               driver_completion_callback_t cb, void *user_data)
+{
+    driver_status_t status = static_write_read(ctx, dev_addr, p_tx, tx_len, p_rx, rx_len);
+
+    if (cb != NULL) {
+        cb(user_data, status);
+    }
+
+    return DRV_OK;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file at24cxx_sim.h
+ * @brief AT24Cxx 行为模拟器 (Behavioral Simulator, 主机测试用)
+ * @note  在 driver_i2c_ops_t 之后模拟芯片的总线行为, 用于无硬件时评估存储层:
+ *        - 页写入在页边界处回卷, 顺序读取在芯片末尾回卷
+ *        - 内部写周期 (tWR) 期间不应答
+ *        - 逐字节写入次数统计 (磨损分析)
+ *        - 页写入中途掉电注入
+ *        模拟器运行在虚拟时间上: 总线传输按时钟频率计时, 延时只推进虚拟时钟,
+ *        1万次写入的耐久测试在主机上只需几毫秒.
+ *        存储阵列与磨损计数数组由调用者分配.
+ */
+
+#ifndef AT24CXX_SIM_H
+#define AT24CXX_SIM_H
+
+#include "at24cxx_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 数据结构 (Data Structures) --- */
+
+/**
+ * @brief 虚拟时钟 (同一总线上的多个模拟芯片共享)
+ */
+typedef struct {
+    uint64_t now_ns;                 /**< 当前虚拟时间 (ns) */
+} at24cxx_sim_clock_t;
+
+/**
+ * @brief 模拟芯片参数
+ */
+typedef struct {
+    uint8_t  device_addr;            /**< 7位基地址 (如 0x50), 块选择位由容量推出 */
+    uint16_t page_size;              /**< 页大小 (bytes) */
+    uint32_t capacity;               /**< 容量 (bytes) */
+    uint8_t  addr_bytes;             /**< 地址字节数 (1 or 2) */
+    uint32_t twr_us;                 /**< 内部写周期 (us) */
+    uint32_t bus_hz;                 /**< I2C 时钟频率 (Hz) */
+} at24cxx_sim_config_t;
+
+/**
+ * @brief 模拟器统计
+ */
+typedef struct {
+    uint32_t transaction_count;      /**< 总线传输次数 (含被拒绝的) */
+    uint32_t nack_count;             /**< 写周期中/掉电时被拒绝的传输次数 */
+    uint32_t page_write_count;       /**< 启动的内部写周期次数 */
+    uint32_t bytes_written;          /**< 写入存储阵列的字节数 */
+    uint32_t bytes_read;             /**< 读出的字节数 */
+    uint32_t max_cell_writes;        /**< 单个字节的最大写入次数 */
+} at24cxx_sim_stats_t;
+
+/**
+ * @brief 模拟芯片对象
+ */
+typedef struct {
+    at24cxx_sim_config_t config;     /**< 芯片参数 */
+    at24cxx_sim_clock_t *p_clock;    /**< 虚拟时钟 */
+    uint8_t *p_mem;                  /**< 存储阵列 (capacity 字节) */
+    uint32_t *p_wear;                /**< 逐字节写入次数 (capacity 项, 可为NULL) */
+    uint8_t block_mask;              /**< 设备地址中的块选择位掩码 */
+    uint32_t address_pointer;        /**< 内部地址指针 */
+    uint64_t busy_until_ns;          /**< 写周期结束时间 */
+    uint32_t power_fail_bytes;       /**< 掉电注入: 下次页写入只提交的字节数 */
+    bool power_fail_armed;           /**< 掉电注入已设置 */
+    bool is_powered;                 /**< 上电状态 */
+    at24cxx_sim_stats_t stats;       /**< 统计信息 */
+    bool is_initialized;             /**< 初始化标志 */
+} at24cxx_sim_t;
+
+/* --- 2. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 初始化模拟芯片 (存储阵列填充为 0xFF, 磨损计数清零)
+ * @param p_sim 模拟芯片对象指针
+ * @param p_config 芯片参数
+ * @param p_clock 虚拟时钟 (由调用者初始化为0)
+ * @param p_mem 存储阵列 (capacity 字节)
+ * @param p_wear 磨损计数数组 (capacity 项, 可为NULL)
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_sim_init(at24cxx_sim_t *p_sim,
+                                 const at24cxx_sim_config_t *p_config,
+                                 at24cxx_sim_clock_t *p_clock,
+                                 uint8_t *p_mem,
+                                 uint32_t *p_wear);
+
+/**
+ * @brief 获取模拟器的 I2C 接口 (总线句柄为模拟芯片对象指针)
+ * @param p_ops 输出 I2C 接口 (含组合写读与异步接口, 异步传输立即完成)
+ */
+void at24cxx_sim_get_i2c_ops(driver_i2c_ops_t *p_ops);
+
+/**
+ * @brief 设置掉电注入: 下一次页写入只提交前 committed_bytes 个字节, 随后芯片断电
+ * @param p_sim 模拟芯片对象指针
+ * @param committed_bytes 提交的字节数 (0: 整页丢失)
+ * @return driver_status_t
+ * @note  断电期间所有传输均不应答, 直到调用 at24cxx_sim_power_on()
+ */
+driver_status_t at24cxx_sim_inject_power_loss(at24cxx_sim_t *p_sim, uint32_t committed_bytes);
+
+/**
+ * @brief 重新上电 (清除写周期与地址指针, 存储内容保持)
+ * @param p_sim 模拟芯片对象指针
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_sim_power_on(at24cxx_sim_t *p_sim);
+
+/**
+ * @brief 获取统计信息
+ * @param p_sim 模拟芯片对象指针
+ * @param p_stats 输出统计信息
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_sim_get_stats(at24cxx_sim_t *p_sim, at24cxx_sim_stats_t *p_stats);
+
+/**
+ * @brief 推进虚拟时钟 (用于实现注入驱动的 delay_us)
+ * @param p_clock 虚拟时钟
+ * @param us 推进时间 (us)
+ */
+void at24cxx_sim_clock_advance_us(at24cxx_sim_clock_t *p_clock, uint32_t us);
+
+/**
+ * @brief 获取虚拟时钟的毫秒数 (用于实现注入驱动的 get_tick)
+ * @param p_clock 虚拟时钟
+ * @return 当前虚拟时间 (ms)
+ */
+uint32_t at24cxx_sim_clock_get_ms(const at24cxx_sim_clock_t *p_clock);
+
+/* --- 3. 辅助宏 (Helper Macros) --- */
+
+/**
+ * @brief 按型号获取默认模拟参数 (地址 0x50, tWR 5ms, 400kHz)
+ */
+#define AT24CXX_SIM_GET_DEFAULT_CONFIG(model) ((at24cxx_sim_config_t){ \
+    .device_addr = 0x50, \
+    .page_size = (model) >= AT24CXX_MODEL_M01 ? 256 : \
+                 (model) >= AT24CXX_MODEL_512 ? 128 : \
+                 (model) >= AT24CXX_MODEL_128 ? 64 : \
+                 (model) >= AT24CXX_MODEL_32 ? 32 : \
+                 (model) >= AT24CXX_MODEL_04 ? 16 : 8, \
+    .capacity = (uint32_t)(model) * 128U, \
+    .addr_bytes = (model) >= AT24CXX_MODEL_32 ? 2 : 1, \
+    .twr_us = 5000, \
+    .bus_hz = 400000 \
+})
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT24CXX_SIM_H */
@@ -0,0 +1,353 @@
+#include "at24cxx_stream.h"
+#include <string.h>
+
+/* --- 1. 私有函数声明 (Private Functions) --- */
+
+static uint16_t static_fetch_length(at24cxx_stream_t *p_stream, uint32_t address);
+static driver_status_t static_wait_bank(at24cxx_stream_t *p_stream, at24cxx_stream_bank_t *p_bank);
+static driver_status_t static_wait_all(at24cxx_stream_t *p_stream);
+static driver_status_t static_lookup(at24cxx_stream_t *p_stream, at24cxx_stream_bank_t **pp_bank);
+static void static_prefetch(at24cxx_stream_t *p_stream, const at24cxx_stream_bank_t *p_current);
+static void static_prefetch_done(void *user_data, driver_status_t status);
+
+/* --- 2. 公共函数实现 (Public Functions) --- */
+
+driver_status_t at24cxx_stream_init(at24cxx_stream_t *p_stream,
+                                    at24cxx_dev_t *p_dev,
+                                    uint8_t *p_buf,
+                                    uint16_t buf_size,
+                                    bool async_prefetch)
+{
+    if (p_stream == NULL || p_dev == NULL || !p_dev->is_initialized || p_buf == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (buf_size < (async_prefetch ? 2U : 1U)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (async_prefetch && p_dev->i2c_ops.write_read_async == NULL &&
+        (p_dev->config.addr_bytes != 1 || p_dev->i2c_ops.read_reg_async == NULL)) {
+        return DRV_ERR_NOT_SUPPORT;
+    }
+
+    memset(p_stream, 0, sizeof(at24cxx_stream_t));
+
+    p_stream->p_dev = p_dev;
+
+    if (async_prefetch) {
+        p_stream->bank_count = 2;
+        p_stream->bank_size = buf_size / 2U;
+        p_stream->banks[0].p_data = p_buf;
+        p_stream->banks[1].p_data = p_buf + p_stream->bank_size;
+    } else {
+        p_stream->bank_count = 1;
+        p_stream->bank_size = buf_size;
+        p_stream->banks[0].p_data = p_buf;
+    }
+
+    p_stream->is_initialized = true;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_stream_seek(at24cxx_stream_t *p_stream, uint32_t address)
+{
+    if (p_stream == NULL || !p_stream->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (address > p_stream->p_dev->config.capacity) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_stream->position = address;
+
+    return DRV_OK;
+}
+
+uint32_t at24cxx_stream_tell(at24cxx_stream_t *p_stream)
+{
+    if (p_stream == NULL || !p_stream->is_initialized) {
+        return 0;
+    }
+
+    return p_stream->position;
+}
+
+driver_status_t at24cxx_stream_read(at24cxx_stream_t *p_stream,
+                                    uint8_t *p_data,
+                                    uint32_t length)
+{
+    at24cxx_stream_bank_t *p_bank;
+    uint32_t done;
+    uint32_t chunk;
+    uint32_t capacity;
+    driver_status_t status;
+
+    if (p_stream == NULL || !p_stream->is_initialized || p_data == NULL || length == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    capacity = p_stream->p_dev->config.capacity;
+    if (p_stream->position >= capacity || length > capacity - p_stream->position) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    done = 0;
+    while (done < length) {
+        status = static_lookup(p_stream, &p_bank);
+        if (status != DRV_OK) {
+            return status;
+        }
+
+        if (p_bank == NULL) {
+            /* 未命中: 先等待总线上的预读结束, 避免与同步读取冲突 */
+            status = static_wait_all(p_stream);
+            if (status != DRV_OK) {
+                return status;
+            }
+
+            /* 大块读取直接读入目标缓冲区, 省去一次拷贝 */
+            if (length - done >= p_stream->bank_size) {
+                status = at24cxx_read(p_stream->p_dev, p_stream->position, p_data + done, length - done);
+                if (status != DRV_OK) {
+                    return status;
+                }
+
+                p_stream->transfer_count++;
+                p_stream->position += length - done;
+                return DRV_OK;
+            }
+
+            p_bank = &p_stream->banks[p_stream->next_bank];
+            p_stream->next_bank = (uint8_t)((p_stream->next_bank + 1U) % p_stream->bank_count);
+
+            p_bank->state = AT24CXX_STREAM_BANK_EMPTY;
+            p_bank->address = p_stream->position;
+            p_bank->length = static_fetch_length(p_stream, p_stream->position);
+
+            status = at24cxx_read(p_stream->p_dev, p_bank->address, p_bank->p_data, p_bank->length);
+            if (status != DRV_OK) {
+                return status;
+            }
+
+            p_stream->transfer_count++;
+            p_bank->state = AT24CXX_STREAM_BANK_READY;
+        }
+
+        chunk = p_bank->address + p_bank->length - p_stream->position;
+        if (chunk > length - done) {
+            chunk = length - done;
+        }
+
+        memcpy(p_data + done, p_bank->p_data + (p_stream->position - p_bank->address), chunk);
+        done += chunk;
+        p_stream->position += chunk;
+
+        p_stream->current_bank = (uint8_t)(p_bank - p_stream->banks);
+
+        if (p_stream->bank_count == 2) {
+            static_prefetch(p_stream, p_bank);
+        }
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_stream_read_byte(at24cxx_stream_t *p_stream, uint8_t *p_byte)
+{
+    at24cxx_stream_bank_t *p_bank;
+
+    if (p_stream == NULL || !p_stream->is_initialized || p_byte == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    /* 快速路径: 命中当前缓冲区 (其后续数据的预读已在首次访问时发起) */
+    p_bank = &p_stream->banks[p_stream->current_bank];
+    if (p_bank->state == AT24CXX_STREAM_BANK_READY && p_stream->position >= p_bank->address &&
+        p_stream->position - p_bank->address < p_bank->length) {
+        *p_byte = p_bank->p_data[p_stream->position - p_bank->address];
+        p_stream->position++;
+        return DRV_OK;
+    }
+
+    return at24cxx_stream_read(p_stream, p_byte, 1);
+}
+
+driver_status_t at24cxx_stream_invalidate(at24cxx_stream_t *p_stream)
+{
+    driver_status_t status;
+    uint8_t i;
+
+    if (p_stream == NULL || !p_stream->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    status = static_wait_all(p_stream);
+
+    /* 超时未完成的传输仍可能写入缓冲区, 保持其状态由完成回调处理 */
+    for (i = 0; i < p_stream->bank_count; i++) {
+        if (p_stream->banks[i].state == AT24CXX_STREAM_BANK_READY) {
+            p_stream->banks[i].state = AT24CXX_STREAM_BANK_EMPTY;
+        }
+    }
+
+    return status;
+}
+
+/* --- 3. 私有函数实现 (Private Functions) --- */
+
+static uint16_t static_fetch_length(at24cxx_stream_t *p_stream, uint32_t address)
+{
+    at24cxx_dev_t *p_dev = p_stream->p_dev;
+    uint32_t block_size = 1UL << (8U * p_dev->config.addr_bytes);
+    uint32_t length = p_stream->bank_size;
+
+    if (length > p_dev->config.capacity - address) {
+        length = p_dev->config.capacity - address;
+    }
+
+    /* 一次传输不能跨越块边界 (块选择位在设备地址中) */
+    if (length > block_size - (address & (block_size - 1U))) {
+        length = block_size - (address & (block_size - 1U));
+    }
+
+    return (uint16_t)length;
+}
+
+static driver_status_t static_wait_bank(at24cxx_stream_t *p_stream, at24cxx_stream_bank_t *p_bank)
+{
+    at24cxx_dev_t *p_dev = p_stream->p_dev;
+    uint32_t start_tick = 0;
+    uint32_t loops = 0;
+
+    /* 已丢弃的缓冲区同样要等待: 其传输仍占用总线, 完成回调到达后才能重新使用 */
+    if (p_bank->state != AT24CXX_STREAM_BANK_LOADING && p_bank->state != AT24CXX_STREAM_BANK_ABANDONED) {
+        return DRV_OK;
+    }
+
+    if (p_dev->has_time_ops) {
+        start_tick = p_dev->time_ops.get_tick();
+    }
+
+    while (p_bank->state == AT24CXX_STREAM_BANK_LOADING || p_bank->state == AT24CXX_STREAM_BANK_ABANDONED) {
+        if (p_dev->has_time_ops) {
+            if (p_dev->time_ops.get_tick() - start_tick > AT24CXX_STREAM_TIMEOUT_MS) {
+                break;
+            }
+        } else if (++loops > AT24CXX_STREAM_WAIT_LOOPS) {
+            break;
+        }
+    }
+
+    if (p_bank->state == AT24CXX_STREAM_BANK_LOADING) {
+        /* 丢弃该缓冲区: 不再命中, 迟到的完成回调只将其恢复为 EMPTY, 不会标记为 READY */
+        p_bank->length = 0;
+        p_bank->state = AT24CXX_STREAM_BANK_ABANDONED;
+        return DRV_ERR_TIMEOUT;
+    }
+    if (p_bank->state == AT24CXX_STREAM_BANK_ABANDONED) {
+        return DRV_ERR_TIMEOUT;
+    }
+
+    return DRV_OK;
+}
+
+static driver_status_t static_wait_all(at24cxx_stream_t *p_stream)
+{
+    driver_status_t status;
+    uint8_t i;
+
+    for (i = 0; i < p_stream->bank_count; i++) {
+        status = static_wait_bank(p_stream, &p_stream->banks[i]);
+        if (status != DRV_OK) {
+            return status;
+        }
+    }
+
+    return DRV_OK;
+}
+
+static driver_status_t static_lookup(at24cxx_stream_t *p_stream, at24cxx_stream_bank_t **pp_bank)
+{
+    at24cxx_stream_bank_t *p_bank;
+    driver_status_t status;
+    uint8_t i;
+
+    *pp_bank = NULL;
+
+    for (i = 0; i < p_stream->bank_count; i++) {
+        p_bank = &p_stream->banks[i];
+
+        if (p_bank->state == AT24CXX_STREAM_BANK_EMPTY ||
+            p_stream->position < p_bank->address ||
+            p_stream->position - p_bank->address >= p_bank->length) {
+            continue;
+        }
+
+        /* 所需数据正在预读: 等待完成即可, 失败时按未命中处理 */
+        status = static_wait_bank(p_stream, p_bank);
+        if (status != DRV_OK) {
+            return status;
+        }
+
+        if (p_bank->state == AT24CXX_STREAM_BANK_READY) {
+            *pp_bank = p_bank;
+            return DRV_OK;
+        }
+    }
+
+    return DRV_OK;
+}
+
+static void static_prefetch(at24cxx_stream_t *p_stream, const at24cxx_stream_bank_t *p_current)
+{
+    at24cxx_stream_bank_t *p_next;
+    uint32_t address;
+    driver_status_t status;
+
+    p_next = (p_current == &p_stream->banks[0]) ? &p_stream->banks[1] : &p_stream->banks[0];
+    address = p_current->address + p_current->length;
+
+    if (address >= p_stream->p_dev->config.capacity || p_next->state == AT24CXX_STREAM_BANK_LOADING ||
+        p_next->state == AT24CXX_STREAM_BANK_ABANDONED) {
+        return;
+    }
+
+    if (p_next->state == AT24CXX_STREAM_BANK_READY && p_next->address == address) {
+        return;
+    }
+
+    p_next->address = address;
+    p_next->length = static_fetch_length(p_stream, address);
+    p_next->state = AT24CXX_STREAM_BANK_LOADING;
+
+    /* 回调可能在发起函数返回前执行, 状态必须先置为 LOADING */
+    status = at24cxx_read_async(p_stream->p_dev, address, p_next->p_data, p_next->length,
+                                static_prefetch_done, p_next);
+    if (status != DRV_OK) {
+        /* 预读尽力而为: 发起失败时下次访问按未命中同步读取 */
+        p_next->state = AT24CXX_STREAM_BANK_EMPTY;
+        return;
+    }
+
+    p_stream->transfer_count++;
+    p_stream->next_bank = (p_current == &p_stream->banks[0]) ? 0U : 1U;
+}
+
+static void static_prefetch_done(void *user_data, driver_status_t status)
+{
+    at24cxx_stream_bank_t *p_bank = (at24cxx_stream_bank_t *)user_data;
+
+    /* 等待超时后缓冲区已被丢弃: 数据可能已过期, 只释放缓冲区 */
+    if (p_bank->state == AT24CXX_STREAM_BANK_ABANDONED) {
+        p_bank->state = AT24CXX_STREAM_BANK_EMPTY;
+        return;
+    }
+    if (p_bank->state != AT24CXX_STREAM_BANK_LOADING) {
+        return;
+    }
+
+    p_bank->state = (status == DRV_OK) ? AT24CXX_STREAM_BANK_READY : AT24CXX_STREAM_BANK_EMPTY;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file at24cxx_stream.h
+ * @brief AT24Cxx 顺序预读流 (Sequential Read-ahead Stream)
+ * @note  逐字节解析 EEPROM 内容 (字库查找, 记录扫描) 时, 每次小读取都要付出
+ *        一次地址阶段与起止条件. 读取流一次读入后续 N 字节到调用者提供的缓冲区,
+ *        小读取直接由 RAM 提供; 双缓冲模式下消费一个缓冲区的同时异步预读下一段.
+ *        读取流只缓存数据, 通过其他途径写入同一区域后需调用 at24cxx_stream_invalidate().
+ */
+
+#ifndef AT24CXX_STREAM_H
+#define AT24CXX_STREAM_H
+
+#include "at24cxx_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#ifndef AT24CXX_STREAM_TIMEOUT_MS
+#define AT24CXX_STREAM_TIMEOUT_MS  100U   /**< 等待异步预读完成的超时 (需注入时间接口) */
+#endif
+
+#ifndef AT24CXX_STREAM_WAIT_LOOPS
+#define AT24CXX_STREAM_WAIT_LOOPS  1000000UL  /**< 未注入时间接口时等待异步预读的最大查询次数 */
+#endif
+
+/* --- 2. 数据结构 (Data Structures) --- */
+
+/**
+ * @brief 预读缓冲区状态
+ */
+typedef enum {
+    AT24CXX_STREAM_BANK_EMPTY     = 0,  /**< 无有效数据 */
+    AT24CXX_STREAM_BANK_LOADING   = 1,  /**< 异步预读进行中 */
+    AT24CXX_STREAM_BANK_READY     = 2,  /**< 数据有效 */
+    AT24CXX_STREAM_BANK_ABANDONED = 3   /**< 等待超时被丢弃, 迟到的完成回调到达前不可使用 */
+} at24cxx_stream_bank_state_t;
+
+/**
+ * @brief 预读缓冲区
+ */
+typedef struct {
+    uint8_t *p_data;                             /**< 数据 (指向调用者缓冲区的一段) */
+    uint32_t address;                            /**< 缓冲数据的起始地址 */
+    uint16_t length;                             /**< 有效数据长度 */
+    volatile at24cxx_stream_bank_state_t state;  /**< 状态 (异步完成回调中更新) */
+} at24cxx_stream_bank_t;
+
+/**
+ * @brief 读取流对象
+ */
+typedef struct {
+    at24cxx_dev_t *p_dev;                  /**< 底层EEPROM设备 */
+    at24cxx_stream_bank_t banks[2];        /**< 预读缓冲区 */
+    uint8_t bank_count;                    /**< 1: 同步预读; 2: 双缓冲异步预读 */
+    uint8_t current_bank;                  /**< 最近一次提供数据的缓冲区 */
+    uint8_t next_bank;                     /**< 下一次未命中时装载的缓冲区 */
+    uint16_t bank_size;                    /**< 单个缓冲区大小 */
+    uint32_t position;                     /**< 当前读取位置 */
+    uint32_t transfer_count;               /**< 累计发起的读取传输次数 */
+    bool is_initialized;                   /**< 初始化标志 */
+} at24cxx_stream_t;
+
+/* --- 3. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 初始化读取流
+ * @param p_stream 读取流对象指针
+ * @param p_dev 已初始化的EEPROM设备
+ * @param p_buf 预读缓冲区
+ * @param buf_size 缓冲区大小 (双缓冲模式下平分为两段)
+ * @param async_prefetch true: 双缓冲异步预读 (需注入 write_read_async,
+ *                       或 1字节地址型号注入 read_reg_async)
+ * @return driver_status_t
+ * @retval DRV_ERR_NOT_SUPPORT 未注入异步读取接口
+ * @note  初始读取位置为 0
+ */
+driver_status_t at24cxx_stream_init(at24cxx_stream_t *p_stream,
+                                    at24cxx_dev_t *p_dev,
+                                    uint8_t *p_buf,
+                                    uint16_t buf_size,
+                                    bool async_prefetch);
+
+/**
+ * @brief 设置读取位置
+ * @param p_stream 读取流对象指针
+ * @param address 新的读取位置 (可等于容量, 表示末尾)
+ * @return driver_status_t
+ * @note  已缓冲的数据保留, 位置落在缓冲区内时不产生总线传输
+ */
+driver_status_t at24cxx_stream_seek(at24cxx_stream_t *p_stream, uint32_t address);
+
+/**
+ * @brief 获取当前读取位置
+ * @param p_stream 读取流对象指针
+ * @return 当前读取位置
+ */
+uint32_t at24cxx_stream_tell(at24cxx_stream_t *p_stream);
+
+/**
+ * @brief 从当前位置顺序读取
+ * @param p_stream 读取流对象指针
+ * @param p_data 读取数据缓冲区
+ * @param length 读取长度 (bytes)
+ * @return driver_status_t
+ * @retval DRV_ERR_TIMEOUT 异步预读未在 AT24CXX_STREAM_TIMEOUT_MS (未注入时间接口时为
+ *         AT24CXX_STREAM_WAIT_LOOPS 次查询) 内完成; 该缓冲区被丢弃, 迟到的完成回调到达前
+ *         不再使用, 期间需要访问总线的读取继续等待并可能再次返回 DRV_ERR_TIMEOUT
+ * @note  未命中且剩余长度不小于缓冲区时直接读入 p_data, 不经过预读缓冲区
+ */
+driver_status_t at24cxx_stream_read(at24cxx_stream_t *p_stream,
+                                    uint8_t *p_data,
+                                    uint32_t length);
+
+/**
+ * @brief 从当前位置读取一个字节
+ * @param p_stream 读取流对象指针
+ * @param p_byte 读取的字节
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_stream_read_byte(at24cxx_stream_t *p_stream, uint8_t *p_byte);
+
+/**
+ * @brief 丢弃全部缓冲数据 (等待进行中的异步预读结束)
+ * @param p_stream 读取流对象指针
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_stream_invalidate(at24cxx_stream_t *p_stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT24CXX_STREAM_H */
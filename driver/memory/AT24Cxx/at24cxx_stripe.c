@@ -0,0 +1,275 @@
+#include "at24cxx_stripe.h"
+#include <string.h>
+
+/* --- 1. 私有函数声明 (Private Functions) --- */
+
+static void static_map(const at24cxx_stripe_t *p_vol,
+                       uint32_t address,
+                       uint8_t *p_chip,
+                       uint32_t *p_chip_addr);
+static driver_status_t static_dispatch(at24cxx_stripe_t *p_vol, uint8_t chip);
+static driver_status_t static_step(at24cxx_stripe_t *p_vol, bool *p_progress);
+
+/* --- 2. 公共函数实现 (Public Functions) --- */
+
+driver_status_t at24cxx_stripe_init(at24cxx_stripe_t *p_vol,
+                                    at24cxx_dev_t *const *pp_devs,
+                                    uint8_t chip_count)
+{
+    uint32_t min_capacity;
+    uint8_t i;
+
+    if (p_vol == NULL || pp_devs == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (chip_count == 0 || chip_count > AT24CXX_STRIPE_MAX_CHIPS) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    memset(p_vol, 0, sizeof(at24cxx_stripe_t));
+
+    min_capacity = 0;
+    for (i = 0; i < chip_count; i++) {
+        if (pp_devs[i] == NULL || !pp_devs[i]->is_initialized) {
+            return DRV_ERR_INVALID_VAL;
+        }
+
+        /* 条带单元为一页, 各芯片页大小必须一致 */
+        if (pp_devs[i]->config.page_size != pp_devs[0]->config.page_size) {
+            return DRV_ERR_NOT_SUPPORT;
+        }
+
+        if (i == 0 || pp_devs[i]->config.capacity < min_capacity) {
+            min_capacity = pp_devs[i]->config.capacity;
+        }
+
+        p_vol->p_devs[i] = pp_devs[i];
+    }
+
+    p_vol->chip_count = chip_count;
+    p_vol->page_size = pp_devs[0]->config.page_size;
+    p_vol->capacity = (min_capacity - min_capacity % p_vol->page_size) * chip_count;
+    p_vol->result = DRV_OK;
+    p_vol->is_initialized = true;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_stripe_read(at24cxx_stripe_t *p_vol,
+                                    uint32_t address,
+                                    uint8_t *p_data,
+                                    uint32_t length)
+{
+    uint32_t done;
+    uint32_t chunk;
+    uint32_t chip_addr;
+    uint8_t chip;
+    driver_status_t status;
+
+    if (p_vol == NULL || !p_vol->is_initialized || p_data == NULL || length == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (address >= p_vol->capacity || length > p_vol->capacity - address) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_vol->is_busy) {
+        return DRV_ERR_BUSY;
+    }
+
+    done = 0;
+    while (done < length) {
+        chunk = p_vol->page_size - (address + done) % p_vol->page_size;
+        if (chunk > length - done) {
+            chunk = length - done;
+        }
+
+        static_map(p_vol, address + done, &chip, &chip_addr);
+
+        status = at24cxx_read(p_vol->p_devs[chip], chip_addr, p_data + done, chunk);
+        if (status != DRV_OK) {
+            return status;
+        }
+
+        done += chunk;
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_stripe_write(at24cxx_stripe_t *p_vol,
+                                     uint32_t address,
+                                     const uint8_t *p_data,
+                                     uint32_t length)
+{
+    at24cxx_dev_t *p_dev;
+    bool progress;
+    driver_status_t status;
+
+    status = at24cxx_stripe_write_begin(p_vol, address, p_data, length);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    p_dev = p_vol->p_devs[0];
+
+    while (1) {
+        status = static_step(p_vol, &progress);
+        if (status != DRV_ERR_BUSY) {
+            return status;
+        }
+
+        /* 所有芯片都在写周期中: 让出一个轮询间隔, 避免空转占满总线 */
+        if (!progress && p_dev->has_time_ops) {
+            p_dev->time_ops.delay_us(p_dev->config.poll_interval_us);
+        }
+    }
+}
+
+driver_status_t at24cxx_stripe_write_begin(at24cxx_stripe_t *p_vol,
+                                           uint32_t address,
+                                           const uint8_t *p_data,
+                                           uint32_t length)
+{
+    uint32_t first_page;
+    uint8_t n;
+    uint8_t i;
+
+    if (p_vol == NULL || !p_vol->is_initialized || p_data == NULL || length == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (address >= p_vol->capacity || length > p_vol->capacity - address) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_vol->is_busy) {
+        return DRV_ERR_BUSY;
+    }
+
+    n = p_vol->chip_count;
+    first_page = address / p_vol->page_size;
+
+    p_vol->p_data = p_data;
+    p_vol->address = address;
+    p_vol->length = length;
+    p_vol->last_page = (address + length - 1) / p_vol->page_size;
+
+    /* 每个芯片从范围内第一个属于自己的卷页开始, 之后每次前进 n 页 */
+    for (i = 0; i < n; i++) {
+        p_vol->next_page[i] = first_page + (uint32_t)((i + n - first_page % n) % n);
+    }
+
+    p_vol->result = DRV_ERR_BUSY;
+    p_vol->is_busy = true;
+
+    return DRV_OK;
+}
+
+driver_status_t at24cxx_stripe_write_step(at24cxx_stripe_t *p_vol)
+{
+    bool progress;
+
+    if (p_vol == NULL || !p_vol->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    return static_step(p_vol, &progress);
+}
+
+/* --- 3. 私有函数实现 (Private Functions) --- */
+
+static void static_map(const at24cxx_stripe_t *p_vol,
+                       uint32_t address,
+                       uint8_t *p_chip,
+                       uint32_t *p_chip_addr)
+{
+    uint32_t page = address / p_vol->page_size;
+
+    *p_chip = (uint8_t)(page % p_vol->chip_count);
+    *p_chip_addr = (page / p_vol->chip_count) * p_vol->page_size + address % p_vol->page_size;
+}
+
+static driver_status_t static_dispatch(at24cxx_stripe_t *p_vol, uint8_t chip)
+{
+    uint32_t page = p_vol->next_page[chip];
+    uint32_t start;
+    uint32_t end;
+    uint32_t chip_addr;
+    uint8_t mapped_chip;
+
+    /* 页内片段: 首尾两页可能只写入一部分 */
+    start = page * p_vol->page_size;
+    end = start + p_vol->page_size;
+
+    if (start < p_vol->address) {
+        start = p_vol->address;
+    }
+
+    if (end > p_vol->address + p_vol->length) {
+        end = p_vol->address + p_vol->length;
+    }
+
+    static_map(p_vol, start, &mapped_chip, &chip_addr);
+
+    p_vol->next_page[chip] += p_vol->chip_count;
+
+    return at24cxx_write_begin(p_vol->p_devs[mapped_chip], chip_addr,
+                               p_vol->p_data + (start - p_vol->address),
+                               end - start, NULL, NULL);
+}
+
+static driver_status_t static_step(at24cxx_stripe_t *p_vol, bool *p_progress)
+{
+    bool active;
+    uint8_t i;
+    driver_status_t status;
+
+    *p_progress = false;
+
+    if (!p_vol->is_busy) {
+        return p_vol->result;
+    }
+
+    active = false;
+
+    /* 每个芯片独立推进, 先完成写周期的芯片先发出下一页 */
+    for (i = 0; i < p_vol->chip_count; i++) {
+        status = at24cxx_write_step(p_vol->p_devs[i]);
+        if (status == DRV_ERR_BUSY) {
+            active = true;
+            continue;
+        }
+
+        if (status != DRV_OK && p_vol->result == DRV_ERR_BUSY) {
+            p_vol->result = status;
+        }
+
+        /* 出错后不再发出新页, 只等待已发出的页完成 */
+        if (p_vol->result != DRV_ERR_BUSY || p_vol->next_page[i] > p_vol->last_page) {
+            continue;
+        }
+
+        status = static_dispatch(p_vol, i);
+        if (status != DRV_OK) {
+            p_vol->result = status;
+            continue;
+        }
+
+        *p_progress = true;
+        active = true;
+    }
+
+    if (active) {
+        return DRV_ERR_BUSY;
+    }
+
+    p_vol->is_busy = false;
+    if (p_vol->result == DRV_ERR_BUSY) {
+        p_vol->result = DRV_OK;
+    }
+
+    return p_vol->result;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file at24cxx_stripe.h
+ * @brief AT24Cxx 多芯片条带卷 (Multi-chip Striped Volume)
+ * @note  卷内连续的页依次分布到各芯片 (卷页 p 位于芯片 p % n).
+ *        写入时每个芯片独立推进自己的页写入任务: 一个芯片处于内部写周期时
+ *        总线立即用于向下一个芯片发送页数据, 完成顺序不固定.
+ *        顺序写入吞吐量随芯片数量近似线性增长.
+ */
+
+#ifndef AT24CXX_STRIPE_H
+#define AT24CXX_STRIPE_H
+
+#include "at24cxx_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#ifndef AT24CXX_STRIPE_MAX_CHIPS
+#define AT24CXX_STRIPE_MAX_CHIPS  4   /**< 单个卷支持的最大芯片数量 */
+#endif
+
+/* --- 2. 数据结构 (Data Structures) --- */
+
+/**
+ * @brief 条带卷对象
+ */
+typedef struct {
+    at24cxx_dev_t *p_devs[AT24CXX_STRIPE_MAX_CHIPS];  /**< 成员芯片 (已初始化) */
+    uint8_t chip_count;                               /**< 芯片数量 */
+    uint16_t page_size;                               /**< 条带单元 (页大小) */
+    uint32_t capacity;                                /**< 卷容量 (bytes) */
+    const uint8_t *p_data;                            /**< 写入数据 (任务完成前必须保持有效) */
+    uint32_t address;                                 /**< 写入起始地址 */
+    uint32_t length;                                  /**< 写入总长度 */
+    uint32_t last_page;                               /**< 写入范围内的最后一个卷页 */
+    uint32_t next_page[AT24CXX_STRIPE_MAX_CHIPS];     /**< 各芯片下一个待写入的卷页 */
+    driver_status_t result;                           /**< 最近一次写入任务的结果 */
+    bool is_busy;                                     /**< 写入任务进行中 */
+    bool is_initialized;                              /**< 初始化标志 */
+} at24cxx_stripe_t;
+
+/* --- 3. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 初始化条带卷
+ * @param p_vol 卷对象指针
+ * @param pp_devs 成员芯片数组 (页大小必须相同)
+ * @param chip_count 芯片数量 (1 ~ AT24CXX_STRIPE_MAX_CHIPS)
+ * @return driver_status_t
+ * @note  卷容量 = 芯片数量 × 最小芯片容量
+ */
+driver_status_t at24cxx_stripe_init(at24cxx_stripe_t *p_vol,
+                                    at24cxx_dev_t *const *pp_devs,
+                                    uint8_t chip_count);
+
+/**
+ * @brief 从卷读取数据
+ * @param p_vol 卷对象指针
+ * @param address 卷地址
+ * @param p_data 读取数据缓冲区
+ * @param length 读取长度 (bytes)
+ * @return driver_status_t
+ * @note  每个条带单元一次读取
+ */
+driver_status_t at24cxx_stripe_read(at24cxx_stripe_t *p_vol,
+                                    uint32_t address,
+                                    uint8_t *p_data,
+                                    uint32_t length);
+
+/**
+ * @brief 向卷写入数据 (阻塞, 内部并行推进各芯片的写周期)
+ * @param p_vol 卷对象指针
+ * @param address 卷地址
+ * @param p_data 写入数据缓冲区
+ * @param length 写入长度 (bytes)
+ * @return driver_status_t
+ */
+driver_status_t at24cxx_stripe_write(at24cxx_stripe_t *p_vol,
+                                     uint32_t address,
+                                     const uint8_t *p_data,
+                                     uint32_t length);
+
+/**
+ * @brief 启动非阻塞卷写入
+ * @param p_vol 卷对象指针
+ * @param address 卷地址
+ * @param p_data 写入数据缓冲区 (任务完成前必须保持有效)
+ * @param length 写入长度 (bytes)
+ * @return driver_status_t
+ * @retval DRV_ERR_BUSY 已有写入任务在进行
+ */
+driver_status_t at24cxx_stripe_write_begin(at24cxx_stripe_t *p_vol,
+                                           uint32_t address,
+                                           const uint8_t *p_data,
+                                           uint32_t length);
+
+/**
+ * @brief 推进非阻塞卷写入: 轮询各芯片, 空闲的芯片立即发出其下一页
+ * @param p_vol 卷对象指针
+ * @return driver_status_t
+ * @retval DRV_OK 写入任务已全部完成 (或无任务)
+ * @retval DRV_ERR_BUSY 写入仍在进行
+ * @retval 其他 写入失败 (等待所有芯片空闲后返回)
+ */
+driver_status_t at24cxx_stripe_write_step(at24cxx_stripe_t *p_vol);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AT24CXX_STRIPE_H */
@@ -0,0 +1,337 @@
+/**
+ * @file mpu6050_calib.c
+ * @brief MPU6050 零偏校准实现
+ */
+
+#include "mpu6050_calib.h"
+#include "../../../core/driver_crc.h"
+
+/* --- 1. 私有宏定义 (Private Macros) --- */
+
+/*
+ * 数据块布局 (16 字节, 大端):
+ * [0] 魔数  [1] 版本  [2..7] 陀螺仪偏置 x/y/z  [8..13] 加速度计偏置 x/y/z
+ * [14..15] CRC-16-CCITT (覆盖前14字节)
+ */
+#define CALIB_MAGIC             0xB6U
+#define CALIB_VERSION           0x01U
+#define CALIB_OFFSET_GYRO       2
+#define CALIB_OFFSET_ACCEL      8
+#define CALIB_OFFSET_CRC        14
+
+/* 单次 FIFO 读取的样本数 (栈上 16 * 14 字节) */
+#define CALIB_READ_BATCH        16
+
+/* 轮询间隔: 约 32 帧 (FIFO 可容纳 85 帧 Accel+Gyro), 限制在 1 ~ 20ms */
+#define CALIB_POLL_FRAMES       32U
+#define CALIB_POLL_MAX_MS       20U
+
+/* 写入偏置后等待 DLPF 稳定 */
+#define CALIB_SETTLE_MS         20U
+
+/* 连续无数据的超时 (在 8 个采样周期之外额外允许的时间) */
+#define CALIB_TIMEOUT_MS        100U
+
+/* 偏置寄存器量程: 陀螺仪 ±1000dps (GYRO_FS 索引 2), 加速度计 ±16g (ACCEL_FS 索引 3) */
+#define CALIB_GYRO_OFFS_FS      2
+#define CALIB_ACCEL_OFFS_FS     3
+
+/* 按 mpu6050_calib_gravity_t 索引: 重力所在轴 (0=X, 1=Y, 2=Z) 与符号 */
+static const uint8_t s_gravity_axis[6] = { 2, 2, 0, 0, 1, 1 };
+static const int8_t s_gravity_sign[6] = { 1, -1, 1, -1, 1, -1 };
+
+/* --- 2. 私有函数声明 (Private Functions) --- */
+
+static driver_status_t static_collect(mpu6050_dev_t *p_dev,
+                                      const mpu6050_calib_config_t *p_config,
+                                      int64_t p_sums[6]);
+static int16_t static_adjust(int16_t offset, int64_t sum, uint8_t fs, int64_t den);
+static void static_put_vector(uint8_t *p_buf, const mpu6050_raw_data_t *p_vec);
+static void static_get_vector(const uint8_t *p_buf, mpu6050_raw_data_t *p_vec);
+
+/* --- 3. 公共函数实现 (Public Functions) --- */
+
+driver_status_t mpu6050_calib_run(mpu6050_dev_t *p_dev,
+                                  const mpu6050_calib_config_t *p_config,
+                                  mpu6050_calib_data_t *p_result)
+{
+    static const mpu6050_calib_config_t default_config = MPU6050_CALIB_DEFAULT_CONFIG;
+    mpu6050_calib_data_t original;
+    mpu6050_calib_data_t current;
+    int64_t sums[6];
+    int64_t gravity = 0;
+    int64_t gyro_den;
+    int64_t accel_den;
+    uint8_t pass;
+    driver_status_t status;
+
+    if (p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_config == NULL) {
+        p_config = &default_config;
+    }
+
+    if (p_config->sample_count == 0 || p_config->passes == 0 ||
+        p_config->passes > MPU6050_CALIB_MAX_PASSES || p_config->gravity > MPU6050_CALIB_GRAVITY_NONE) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_dev->fifo_sensors != 0 || p_dev->drdy.is_active || p_dev->wom.is_active) {
+        return DRV_ERR_BUSY;
+    }
+
+    status = mpu6050_calib_read(p_dev, &original);
+    if (status != DRV_OK) {
+        return status;
+    }
+    current = original;
+
+    /*
+     * 平均零偏 (当前量程 LSB) 换算到偏置寄存器量程:
+     * 量程索引每增加1灵敏度减半, offset = sum / N * 2^fs / 2^offs_fs
+     */
+    gyro_den = (int64_t)p_config->sample_count << CALIB_GYRO_OFFS_FS;
+    accel_den = (int64_t)p_config->sample_count << CALIB_ACCEL_OFFS_FS;
+    if (p_config->gravity != MPU6050_CALIB_GRAVITY_NONE) {
+        gravity = (int64_t)p_config->sample_count * p_dev->accel_sensitivity *
+                  s_gravity_sign[p_config->gravity];
+    }
+
+    for (pass = 0; pass < p_config->passes; pass++) {
+        status = static_collect(p_dev, p_config, sums);
+        if (status != DRV_OK) {
+            mpu6050_calib_apply(p_dev, &original);
+            return status;
+        }
+
+        current.gyro_offset.x = static_adjust(current.gyro_offset.x, sums[3], p_dev->gyro_fs, gyro_den);
+        current.gyro_offset.y = static_adjust(current.gyro_offset.y, sums[4], p_dev->gyro_fs, gyro_den);
+        current.gyro_offset.z = static_adjust(current.gyro_offset.z, sums[5], p_dev->gyro_fs, gyro_den);
+
+        if (p_config->gravity != MPU6050_CALIB_GRAVITY_NONE) {
+            sums[s_gravity_axis[p_config->gravity]] -= gravity;
+            current.accel_offset.x = static_adjust(current.accel_offset.x, sums[0], p_dev->accel_fs, accel_den);
+            current.accel_offset.y = static_adjust(current.accel_offset.y, sums[1], p_dev->accel_fs, accel_den);
+            current.accel_offset.z = static_adjust(current.accel_offset.z, sums[2], p_dev->accel_fs, accel_den);
+        }
+
+        status = mpu6050_calib_apply(p_dev, &current);
+        if (status != DRV_OK) {
+            return status;
+        }
+    }
+
+    if (p_result != NULL) {
+        /* 加速度计 bit0 由芯片保留, 读回实际写入的值 */
+        return mpu6050_calib_read(p_dev, p_result);
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_calib_read(mpu6050_dev_t *p_dev, mpu6050_calib_data_t *p_data)
+{
+    driver_status_t status;
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_data == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    status = mpu6050_get_gyro_offset(p_dev, &p_data->gyro_offset);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    return mpu6050_get_accel_offset(p_dev, &p_data->accel_offset);
+}
+
+driver_status_t mpu6050_calib_apply(mpu6050_dev_t *p_dev, const mpu6050_calib_data_t *p_data)
+{
+    driver_status_t status;
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_data == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    status = mpu6050_set_gyro_offset(p_dev, &p_data->gyro_offset);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    return mpu6050_set_accel_offset(p_dev, &p_data->accel_offset);
+}
+
+driver_status_t mpu6050_calib_export(const mpu6050_calib_data_t *p_data, uint8_t *p_blob, uint16_t size)
+{
+    uint16_t crc;
+
+    if (p_data == NULL || p_blob == NULL || size < MPU6050_CALIB_BLOB_SIZE) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_blob[0] = CALIB_MAGIC;
+    p_blob[1] = CALIB_VERSION;
+    static_put_vector(&p_blob[CALIB_OFFSET_GYRO], &p_data->gyro_offset);
+    static_put_vector(&p_blob[CALIB_OFFSET_ACCEL], &p_data->accel_offset);
+
+    crc = driver_crc16_ccitt(p_blob, CALIB_OFFSET_CRC);
+    p_blob[CALIB_OFFSET_CRC] = DRV_U16_HIGH(crc);
+    p_blob[CALIB_OFFSET_CRC + 1] = DRV_U16_LOW(crc);
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_calib_import(mpu6050_calib_data_t *p_data, const uint8_t *p_blob, uint16_t size)
+{
+    if (p_data == NULL || p_blob == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (size < MPU6050_CALIB_BLOB_SIZE || p_blob[0] != CALIB_MAGIC || p_blob[1] != CALIB_VERSION ||
+        DRV_MAKE_U16(p_blob[CALIB_OFFSET_CRC], p_blob[CALIB_OFFSET_CRC + 1]) !=
+        driver_crc16_ccitt(p_blob, CALIB_OFFSET_CRC)) {
+        return DRV_ERR_COMMON;
+    }
+
+    static_get_vector(&p_blob[CALIB_OFFSET_GYRO], &p_data->gyro_offset);
+    static_get_vector(&p_blob[CALIB_OFFSET_ACCEL], &p_data->accel_offset);
+
+    return DRV_OK;
+}
+
+/* --- 4. 私有函数实现 (Private Functions) --- */
+
+/**
+ * @brief 通过 FIFO 采集 sample_count 个 Accel+Gyro 样本并累加
+ * @param p_sums 输出累加和: [0..2] 加速度 x/y/z, [3..5] 角速度 x/y/z
+ */
+static driver_status_t static_collect(mpu6050_dev_t *p_dev,
+                                      const mpu6050_calib_config_t *p_config,
+                                      int64_t p_sums[6])
+{
+    mpu6050_fifo_sample_t samples[CALIB_READ_BATCH];
+    int16_t gyro_min[3] = { INT16_MAX, INT16_MAX, INT16_MAX };
+    int16_t gyro_max[3] = { INT16_MIN, INT16_MIN, INT16_MIN };
+    int16_t gyro[3];
+    uint32_t period_us = mpu6050_get_sample_period_us(p_dev);
+    uint32_t poll_ms;
+    uint32_t idle_ms = 0;
+    uint32_t timeout_ms;
+    uint16_t collected = 0;
+    uint16_t request;
+    uint16_t count;
+    uint16_t i;
+    uint8_t axis;
+    driver_status_t status;
+
+    for (axis = 0; axis < 6; axis++) {
+        p_sums[axis] = 0;
+    }
+
+    poll_ms = (period_us * CALIB_POLL_FRAMES) / 1000U;
+    if (poll_ms == 0) poll_ms = 1;
+    if (poll_ms > CALIB_POLL_MAX_MS) poll_ms = CALIB_POLL_MAX_MS;
+    timeout_ms = (period_us * 8U) / 1000U + CALIB_TIMEOUT_MS;
+
+    p_dev->time_ops.delay_ms(CALIB_SETTLE_MS);
+
+    status = mpu6050_fifo_enable(p_dev, MPU6050_FIFO_ACCEL | MPU6050_FIFO_GYRO);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    while (collected < p_config->sample_count) {
+        p_dev->time_ops.delay_ms(poll_ms);
+        idle_ms += poll_ms;
+
+        do {
+            request = (uint16_t)(p_config->sample_count - collected);
+            if (request > CALIB_READ_BATCH) request = CALIB_READ_BATCH;
+
+            status = mpu6050_fifo_read(p_dev, samples, request, &count);
+            if (status == DRV_ERR_NO_MEM) {
+                /* 溢出: FIFO 已被驱动清空, 丢弃本批继续采集 */
+                break;
+            }
+            if (status != DRV_OK) {
+                mpu6050_fifo_disable(p_dev);
+                return status;
+            }
+
+            for (i = 0; i < count; i++) {
+                gyro[0] = samples[i].gyro.x;
+                gyro[1] = samples[i].gyro.y;
+                gyro[2] = samples[i].gyro.z;
+
+                p_sums[0] += samples[i].accel.x;
+                p_sums[1] += samples[i].accel.y;
+                p_sums[2] += samples[i].accel.z;
+
+                for (axis = 0; axis < 3; axis++) {
+                    p_sums[3 + axis] += gyro[axis];
+                    if (gyro[axis] < gyro_min[axis]) gyro_min[axis] = gyro[axis];
+                    if (gyro[axis] > gyro_max[axis]) gyro_max[axis] = gyro[axis];
+                }
+            }
+
+            collected = (uint16_t)(collected + count);
+            if (count != 0) {
+                idle_ms = 0;
+            }
+        } while (count == request && collected < p_config->sample_count);
+
+        if (idle_ms > timeout_ms) {
+            mpu6050_fifo_disable(p_dev);
+            return DRV_ERR_TIMEOUT;
+        }
+    }
+
+    status = mpu6050_fifo_disable(p_dev);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    if (p_config->motion_threshold != 0) {
+        for (axis = 0; axis < 3; axis++) {
+            if ((int32_t)gyro_max[axis] - gyro_min[axis] > (int32_t)p_config->motion_threshold) {
+                return DRV_ERR_COMMON;
+            }
+        }
+    }
+
+    return DRV_OK;
+}
+
+/**
+ * @brief 从偏置中减去 sum * 2^fs / den (四舍五入), 结果饱和到 int16
+ */
+static int16_t static_adjust(int16_t offset, int64_t sum, uint8_t fs, int64_t den)
+{
+    int64_t num = sum * ((int64_t)1 << fs);
+    int64_t result;
+
+    result = offset - ((num >= 0) ? (num + den / 2) / den : -((-num + den / 2) / den));
+
+    if (result > INT16_MAX) return INT16_MAX;
+    if (result < INT16_MIN) return INT16_MIN;
+    return (int16_t)result;
+}
+
+static void static_put_vector(uint8_t *p_buf, const mpu6050_raw_data_t *p_vec)
+{
+    p_buf[0] = DRV_U16_HIGH(p_vec->x);
+    p_buf[1] = DRV_U16_LOW(p_vec->x);
+    p_buf[2] = DRV_U16_HIGH(p_vec->y);
+    p_buf[3] = DRV_U16_LOW(p_vec->y);
+    p_buf[4] = DRV_U16_HIGH(p_vec->z);
+    p_buf[5] = DRV_U16_LOW(p_vec->z);
+}
+
+static void static_get_vector(const uint8_t *p_buf, mpu6050_raw_data_t *p_vec)
+{
+    p_vec->x = (int16_t)DRV_MAKE_U16(p_buf[0], p_buf[1]);
+    p_vec->y = (int16_t)DRV_MAKE_U16(p_buf[2], p_buf[3]);
+    p_vec->z = (int16_t)DRV_MAKE_U16(p_buf[4], p_buf[5]);
+}
@@ -0,0 +1,137 @@
+/**
+ * @file mpu6050_calib.h
+ * @brief MPU6050 零偏校准 (Bias Calibration)
+ * @note  静止状态下通过 FIFO 批量采集样本, 以 64 位整数累加求平均零偏,
+ *        换算后写入芯片的硬件偏置寄存器:
+ *        - 陀螺仪 XG/YG/ZG_OFFS_USR (0x13 ~ 0x18), ±1000dps 量程单位
+ *        - 加速度计 XA/YA/ZA_OFFS (0x06 ~ 0x0B), ±16g 量程单位, 在出厂值基础上修正
+ *        校准后芯片直接输出扣除零偏的数据 (包括数据寄存器与 FIFO), 每个样本没有额外的主机开销.
+ *        结果可导出为带 CRC 的定长数据块存入 EEPROM (如 at24cxx_cfgstore),
+ *        上电时导入并写回寄存器, 无需重新采集.
+ *
+ * @section calib_usage 使用示例
+ * @code
+ * mpu6050_calib_config_t cfg = MPU6050_CALIB_DEFAULT_CONFIG;
+ * mpu6050_calib_data_t calib;
+ * uint8_t blob[MPU6050_CALIB_BLOB_SIZE];
+ *
+ * if (mpu6050_calib_import(&calib, stored, stored_len) == DRV_OK) {
+ *     mpu6050_calib_apply(&mpu_dev, &calib);           // 快速启动
+ * } else if (mpu6050_calib_run(&mpu_dev, &cfg, &calib) == DRV_OK) {
+ *     mpu6050_calib_export(&calib, blob, sizeof(blob));
+ *     at24cxx_cfgstore_save(&store, blob, sizeof(blob));
+ * }
+ * @endcode
+ */
+
+#ifndef _MPU6050_CALIB_H_
+#define _MPU6050_CALIB_H_
+
+#include "mpu6050_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#define MPU6050_CALIB_BLOB_SIZE      16   /**< 导出数据块长度 (bytes) */
+#define MPU6050_CALIB_MAX_PASSES     4    /**< 最大迭代次数 */
+
+/* --- 2. 枚举定义 (Enumerations) --- */
+
+/**
+ * @brief 校准时重力所在的轴 (传感器静止放置的朝向)
+ */
+typedef enum {
+    MPU6050_CALIB_GRAVITY_Z_POS = 0,  /**< 水平放置, 芯片正面朝上 */
+    MPU6050_CALIB_GRAVITY_Z_NEG,
+    MPU6050_CALIB_GRAVITY_X_POS,
+    MPU6050_CALIB_GRAVITY_X_NEG,
+    MPU6050_CALIB_GRAVITY_Y_POS,
+    MPU6050_CALIB_GRAVITY_Y_NEG,
+    MPU6050_CALIB_GRAVITY_NONE,       /**< 只校准陀螺仪, 不修改加速度计偏置 */
+} mpu6050_calib_gravity_t;
+
+/* --- 3. 数据结构 (Data Structures) --- */
+
+/**
+ * @brief 校准配置
+ */
+typedef struct {
+    uint16_t sample_count;            /**< 每次迭代采集的样本数 */
+    uint8_t  passes;                  /**< 迭代次数 (1 ~ MPU6050_CALIB_MAX_PASSES), 第2次起修正残差 */
+    mpu6050_calib_gravity_t gravity;  /**< 重力方向 */
+    uint16_t motion_threshold;        /**< 陀螺仪峰峰值上限 (原始 LSB), 超过视为移动; 0 不检查 */
+} mpu6050_calib_config_t;
+
+/** 默认配置: 1000 样本, 2 次迭代, Z 轴朝上, 不检查移动 */
+#define MPU6050_CALIB_DEFAULT_CONFIG { 1000, 2, MPU6050_CALIB_GRAVITY_Z_POS, 0 }
+
+/**
+ * @brief 校准结果 (硬件偏置寄存器的值)
+ */
+typedef struct {
+    mpu6050_raw_data_t gyro_offset;   /**< 陀螺仪偏置 (±1000dps 量程 LSB) */
+    mpu6050_raw_data_t accel_offset;  /**< 加速度计偏置 (±16g 量程 LSB) */
+} mpu6050_calib_data_t;
+
+/* --- 4. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 执行零偏校准并写入硬件偏置寄存器
+ * @param p_dev 已初始化的设备句柄 (FIFO, 数据就绪中断与运动唤醒均未使用)
+ * @param p_config 校准配置 (NULL 使用默认配置)
+ * @param p_result 输出写入寄存器的偏置值 (可为NULL)
+ * @return driver_status_t
+ * @retval DRV_ERR_BUSY FIFO, 数据就绪中断或运动唤醒正在使用
+ * @retval DRV_ERR_COMMON 检测到移动 (陀螺仪峰峰值超过阈值), 寄存器保持校准前的值
+ * @retval DRV_ERR_TIMEOUT FIFO 长时间没有数据
+ * @note  阻塞执行, 耗时约 passes * sample_count * 采样周期; 期间传感器必须静止.
+ *        结束后 FIFO 保持关闭
+ */
+driver_status_t mpu6050_calib_run(mpu6050_dev_t *p_dev,
+                                  const mpu6050_calib_config_t *p_config,
+                                  mpu6050_calib_data_t *p_result);
+
+/**
+ * @brief 读取当前硬件偏置寄存器
+ * @param p_dev 设备句柄指针
+ * @param p_data 输出偏置值
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_calib_read(mpu6050_dev_t *p_dev, mpu6050_calib_data_t *p_data);
+
+/**
+ * @brief 将校准结果写入硬件偏置寄存器 (如上电时恢复)
+ * @param p_dev 设备句柄指针
+ * @param p_data 偏置值
+ * @return driver_status_t
+ * @note  mpu6050_init/mpu6050_reset 复位芯片后偏置寄存器恢复出厂值, 需重新写入
+ */
+driver_status_t mpu6050_calib_apply(mpu6050_dev_t *p_dev, const mpu6050_calib_data_t *p_data);
+
+/**
+ * @brief 导出为带 CRC 的数据块 (大端, 与平台字节序无关)
+ * @param p_data 偏置值
+ * @param p_blob 输出缓冲区
+ * @param size 缓冲区大小 (不小于 MPU6050_CALIB_BLOB_SIZE)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_calib_export(const mpu6050_calib_data_t *p_data, uint8_t *p_blob, uint16_t size);
+
+/**
+ * @brief 从数据块导入并校验
+ * @param p_data 输出偏置值
+ * @param p_blob 数据块
+ * @param size 数据块长度
+ * @return driver_status_t
+ * @retval DRV_ERR_COMMON 魔数/版本/CRC 不匹配
+ */
+driver_status_t mpu6050_calib_import(mpu6050_calib_data_t *p_data, const uint8_t *p_blob, uint16_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MPU6050_CALIB_H_ */
@@ -0,0 +1,399 @@
+/**
+ * @file mpu6050_convert.c
+ * @brief MPU6050 批量原始数据转换实现
+ */
+
+#include "mpu6050_convert.h"
+
+#if MPU6050_CONVERT_USE_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#define MPU6050_CONVERT_SSE2
+#elif MPU6050_CONVERT_USE_SIMD && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define MPU6050_CONVERT_NEON
+#endif
+
+/* --- 1. 私有宏定义 (Private Macros) --- */
+
+/* 大端原始值: 帧内第 word 个16位字 */
+#define CONVERT_RAW(p, word)   ((int16_t)(((p)[2 * (word)] << 8) | (p)[2 * (word) + 1]))
+
+/* 向量化每组处理的帧数 */
+#define CONVERT_GROUP          4
+
+/* Q16.16 乘积移位上限: ±2g 时加速度乘数 2^(16+12)/16384 已达15位 */
+#define CONVERT_Q_SHIFT_MAX    12
+
+/* --- 2. 私有函数声明 (Private Functions) --- */
+
+static int16_t static_q_mul(uint32_t lsb_x10, uint8_t shift);
+#if MPU6050_USE_FLOAT
+static void static_f32_scalar(const mpu6050_convert_t *p_conv, const uint8_t *p_frames,
+                              uint32_t start, uint32_t count, const mpu6050_soa_f32_t *p_out);
+#endif
+static void static_q16_scalar(const mpu6050_convert_t *p_conv, const uint8_t *p_frames,
+                              uint32_t start, uint32_t count, const mpu6050_soa_q16_t *p_out);
+#if defined(MPU6050_CONVERT_SSE2) || defined(MPU6050_CONVERT_NEON)
+#if MPU6050_USE_FLOAT
+static uint32_t static_f32_simd(const mpu6050_convert_t *p_conv, const uint8_t *p_frames,
+                                uint32_t count, const mpu6050_soa_f32_t *p_out);
+#endif
+static uint32_t static_q16_simd(const mpu6050_convert_t *p_conv, const uint8_t *p_frames,
+                                uint32_t count, const mpu6050_soa_q16_t *p_out);
+#endif
+
+/* --- 3. 公共函数实现 (Public Functions) --- */
+
+driver_status_t mpu6050_convert_init(mpu6050_convert_t *p_conv,
+                                     const mpu6050_dev_t *p_dev,
+                                     uint8_t sensors)
+{
+    uint32_t accel_x10;
+    uint32_t gyro_x10;
+    uint8_t shift;
+
+    if (p_conv == NULL || p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if ((sensors & (MPU6050_FIFO_ACCEL | MPU6050_FIFO_GYRO)) != (MPU6050_FIFO_ACCEL | MPU6050_FIFO_GYRO) ||
+        (sensors & ~(MPU6050_FIFO_ACCEL | MPU6050_FIFO_GYRO | MPU6050_FIFO_TEMP)) != 0) {
+        return DRV_ERR_NOT_SUPPORT;
+    }
+
+    p_conv->is_initialized = false;
+#if MPU6050_USE_FLOAT
+    p_conv->accel_scale = 1.0f / (float)p_dev->accel_sensitivity;
+    p_conv->gyro_scale = 1.0f / p_dev->gyro_sensitivity;
+#endif
+
+    if (sensors & MPU6050_FIFO_TEMP) {
+        p_conv->frame_size = 14;
+        p_conv->gyro_offset = 8;
+    } else {
+        p_conv->frame_size = 12;
+        p_conv->gyro_offset = 6;
+    }
+
+    /* 取两个乘数都不超过15位的最大移位, 精度最高且 int16 x int16 乘积不溢出 */
+    accel_x10 = (uint32_t)p_dev->accel_sensitivity * 10U;
+    gyro_x10 = g_mpu6050_gyro_lsb_x10[p_dev->gyro_fs];
+    shift = CONVERT_Q_SHIFT_MAX;
+    while (shift > 0 &&
+           (static_q_mul(accel_x10, shift) < 0 || static_q_mul(gyro_x10, shift) < 0)) {
+        shift--;
+    }
+
+    p_conv->q_shift = shift;
+    p_conv->accel_q_mul = static_q_mul(accel_x10, shift);
+    p_conv->gyro_q_mul = static_q_mul(gyro_x10, shift);
+    if (p_conv->accel_q_mul < 0 || p_conv->gyro_q_mul < 0) {
+        return DRV_ERR_NOT_SUPPORT;
+    }
+
+    p_conv->is_initialized = true;
+    return DRV_OK;
+}
+
+#if MPU6050_USE_FLOAT
+driver_status_t mpu6050_convert_f32(const mpu6050_convert_t *p_conv,
+                                    const uint8_t *p_frames,
+                                    uint32_t count,
+                                    const mpu6050_soa_f32_t *p_out)
+{
+    uint32_t done = 0;
+
+    if (p_conv == NULL || !p_conv->is_initialized || p_frames == NULL || p_out == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+    if (p_out->p_ax == NULL || p_out->p_ay == NULL || p_out->p_az == NULL ||
+        p_out->p_gx == NULL || p_out->p_gy == NULL || p_out->p_gz == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+#if defined(MPU6050_CONVERT_SSE2) || defined(MPU6050_CONVERT_NEON)
+    done = static_f32_simd(p_conv, p_frames, count, p_out);
+#endif
+    static_f32_scalar(p_conv, p_frames, done, count, p_out);
+
+    return DRV_OK;
+}
+#endif
+
+driver_status_t mpu6050_convert_q16(const mpu6050_convert_t *p_conv,
+                                    const uint8_t *p_frames,
+                                    uint32_t count,
+                                    const mpu6050_soa_q16_t *p_out)
+{
+    uint32_t done = 0;
+
+    if (p_conv == NULL || !p_conv->is_initialized || p_frames == NULL || p_out == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+    if (p_out->p_ax == NULL || p_out->p_ay == NULL || p_out->p_az == NULL ||
+        p_out->p_gx == NULL || p_out->p_gy == NULL || p_out->p_gz == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+#if defined(MPU6050_CONVERT_SSE2) || defined(MPU6050_CONVERT_NEON)
+    done = static_q16_simd(p_conv, p_frames, count, p_out);
+#endif
+    static_q16_scalar(p_conv, p_frames, done, count, p_out);
+
+    return DRV_OK;
+}
+
+/* --- 4. 私有函数实现 (Private Functions) --- */
+
+/**
+ * @brief 计算 Q16.16 乘数: round(2^(16+shift) / sensitivity), 纯整数运算
+ * @param lsb_x10 灵敏度 x10 (LSB/g 或 LSB/dps)
+ * @param shift 乘积右移位数 (不超过 CONVERT_Q_SHIFT_MAX, 10 << 28 不超过 uint32)
+ * @return 乘数, 超过15位时返回 -1
+ */
+static int16_t static_q_mul(uint32_t lsb_x10, uint8_t shift)
+{
+    uint32_t mul = ((10UL << (MPU6050_CONVERT_Q_FRAC_BITS + shift)) + lsb_x10 / 2U) / lsb_x10;
+
+    if (mul >= 32768U) {
+        return -1;
+    }
+    return (int16_t)mul;
+}
+
+#if MPU6050_USE_FLOAT
+static void static_f32_scalar(const mpu6050_convert_t *p_conv, const uint8_t *p_frames,
+                              uint32_t start, uint32_t count, const mpu6050_soa_f32_t *p_out)
+{
+    const float as = p_conv->accel_scale;
+    const float gs = p_conv->gyro_scale;
+    const uint8_t *p;
+    const uint8_t *g;
+    uint32_t i;
+
+    for (i = start; i < count; i++) {
+        p = p_frames + i * p_conv->frame_size;
+        g = p + p_conv->gyro_offset;
+        p_out->p_ax[i] = (float)CONVERT_RAW(p, 0) * as;
+        p_out->p_ay[i] = (float)CONVERT_RAW(p, 1) * as;
+        p_out->p_az[i] = (float)CONVERT_RAW(p, 2) * as;
+        p_out->p_gx[i] = (float)CONVERT_RAW(g, 0) * gs;
+        p_out->p_gy[i] = (float)CONVERT_RAW(g, 1) * gs;
+        p_out->p_gz[i] = (float)CONVERT_RAW(g, 2) * gs;
+    }
+}
+#endif
+
+static void static_q16_scalar(const mpu6050_convert_t *p_conv, const uint8_t *p_frames,
+                              uint32_t start, uint32_t count, const mpu6050_soa_q16_t *p_out)
+{
+    const int32_t am = p_conv->accel_q_mul;
+    const int32_t gm = p_conv->gyro_q_mul;
+    const uint8_t sh = p_conv->q_shift;
+    const uint8_t *p;
+    const uint8_t *g;
+    uint32_t i;
+
+    for (i = start; i < count; i++) {
+        p = p_frames + i * p_conv->frame_size;
+        g = p + p_conv->gyro_offset;
+        p_out->p_ax[i] = (CONVERT_RAW(p, 0) * am) >> sh;
+        p_out->p_ay[i] = (CONVERT_RAW(p, 1) * am) >> sh;
+        p_out->p_az[i] = (CONVERT_RAW(p, 2) * am) >> sh;
+        p_out->p_gx[i] = (CONVERT_RAW(g, 0) * gm) >> sh;
+        p_out->p_gy[i] = (CONVERT_RAW(g, 1) * gm) >> sh;
+        p_out->p_gz[i] = (CONVERT_RAW(g, 2) * gm) >> sh;
+    }
+}
+
+/*
+ * 向量化实现: 每帧一次16字节加载 (8个16位字, 超出帧尾的字被忽略), 字节交换后扩展为两个
+ * 32位向量 (字0-3, 字4-7); 4帧一组转置后每个向量即为同一分量的4个样本, 直接写入 SoA.
+ * 16字节加载会越过帧尾, 因此只处理其后仍有完整帧的组, 剩余帧交给标量实现.
+ */
+#if defined(MPU6050_CONVERT_SSE2)
+
+/* 加载一帧的8个16位字并转换为本机字节序 */
+static inline __m128i static_sse_load_be16(const uint8_t *p)
+{
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+#if MPU6050_USE_FLOAT
+static inline void static_sse_store_rows(const __m128 rows[8], uint8_t g0, uint32_t i,
+                                         float *p_ax, float *p_ay, float *p_az,
+                                         float *p_gx, float *p_gy, float *p_gz,
+                                         __m128 as, __m128 gs)
+{
+    _mm_storeu_ps(p_ax + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(rows[0])), as));
+    _mm_storeu_ps(p_ay + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(rows[1])), as));
+    _mm_storeu_ps(p_az + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(rows[2])), as));
+    _mm_storeu_ps(p_gx + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(rows[g0])), gs));
+    _mm_storeu_ps(p_gy + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(rows[g0 + 1])), gs));
+    _mm_storeu_ps(p_gz + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(rows[g0 + 2])), gs));
+}
+
+static uint32_t static_f32_simd(const mpu6050_convert_t *p_conv, const uint8_t *p_frames,
+                                uint32_t count, const mpu6050_soa_f32_t *p_out)
+{
+    const __m128 as = _mm_set1_ps(p_conv->accel_scale);
+    const __m128 gs = _mm_set1_ps(p_conv->gyro_scale);
+    const uint8_t g0 = (uint8_t)(p_conv->gyro_offset / 2);
+    __m128 rows[8];
+    __m128i v;
+    uint32_t i;
+    uint8_t k;
+
+    for (i = 0; i + CONVERT_GROUP < count; i += CONVERT_GROUP) {
+        for (k = 0; k < CONVERT_GROUP; k++) {
+            v = static_sse_load_be16(p_frames + (i + k) * p_conv->frame_size);
+            /* 与自身交错后算术右移16位: 符号扩展为 int32 */
+            rows[k] = _mm_castsi128_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+            rows[k + 4] = _mm_castsi128_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+        }
+        _MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+        _MM_TRANSPOSE4_PS(rows[4], rows[5], rows[6], rows[7]);
+
+        static_sse_store_rows(rows, g0, i, p_out->p_ax, p_out->p_ay, p_out->p_az,
+                              p_out->p_gx, p_out->p_gy, p_out->p_gz, as, gs);
+    }
+
+    return i;
+}
+
+#endif
+
+static uint32_t static_q16_simd(const mpu6050_convert_t *p_conv, const uint8_t *p_frames,
+                                uint32_t count, const mpu6050_soa_q16_t *p_out)
+{
+    const uint8_t g0 = (uint8_t)(p_conv->gyro_offset / 2);
+    const __m128i sh = _mm_cvtsi32_si128(p_conv->q_shift);
+    int16_t mul[8] = {0};
+    __m128i kv;
+    __m128i v;
+    __m128i lo;
+    __m128i hi;
+    __m128 rows[8];
+    uint32_t i;
+    uint8_t k;
+
+    /* 每个16位字对应的乘数: 加速度字0-2, 陀螺仪字 g0..g0+2, 其余为0 */
+    mul[0] = mul[1] = mul[2] = p_conv->accel_q_mul;
+    mul[g0] = mul[g0 + 1] = mul[g0 + 2] = p_conv->gyro_q_mul;
+    kv = _mm_loadu_si128((const __m128i *)mul);
+
+    for (i = 0; i + CONVERT_GROUP < count; i += CONVERT_GROUP) {
+        for (k = 0; k < CONVERT_GROUP; k++) {
+            v = static_sse_load_be16(p_frames + (i + k) * p_conv->frame_size);
+            /* 16x16 位乘法的低/高半部分交错即为完整的32位乘积 */
+            lo = _mm_mullo_epi16(v, kv);
+            hi = _mm_mulhi_epi16(v, kv);
+            rows[k] = _mm_castsi128_ps(_mm_sra_epi32(_mm_unpacklo_epi16(lo, hi), sh));
+            rows[k + 4] = _mm_castsi128_ps(_mm_sra_epi32(_mm_unpackhi_epi16(lo, hi), sh));
+        }
+        _MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+        _MM_TRANSPOSE4_PS(rows[4], rows[5], rows[6], rows[7]);
+
+        _mm_storeu_si128((__m128i *)(p_out->p_ax + i), _mm_castps_si128(rows[0]));
+        _mm_storeu_si128((__m128i *)(p_out->p_ay + i), _mm_castps_si128(rows[1]));
+        _mm_storeu_si128((__m128i *)(p_out->p_az + i), _mm_castps_si128(rows[2]));
+        _mm_storeu_si128((__m128i *)(p_out->p_gx + i), _mm_castps_si128(rows[g0]));
+        _mm_storeu_si128((__m128i *)(p_out->p_gy + i), _mm_castps_si128(rows[g0 + 1]));
+        _mm_storeu_si128((__m128i *)(p_out->p_gz + i), _mm_castps_si128(rows[g0 + 2]));
+    }
+
+    return i;
+}
+
+#elif defined(MPU6050_CONVERT_NEON)
+
+/* 4x4 转置: 输入 r[0..3] 为4帧, 输出 r[0..3] 为4个分量 */
+static inline void static_neon_transpose(int32x4_t r[4])
+{
+    int32x4x2_t t01 = vtrnq_s32(r[0], r[1]);
+    int32x4x2_t t23 = vtrnq_s32(r[2], r[3]);
+
+    r[0] = vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0]));
+    r[1] = vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1]));
+    r[2] = vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0]));
+    r[3] = vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1]));
+}
+
+static inline int16x8_t static_neon_load_be16(const uint8_t *p)
+{
+    return vreinterpretq_s16_u8(vrev16q_u8(vld1q_u8(p)));
+}
+
+#if MPU6050_USE_FLOAT
+static uint32_t static_f32_simd(const mpu6050_convert_t *p_conv, const uint8_t *p_frames,
+                                uint32_t count, const mpu6050_soa_f32_t *p_out)
+{
+    const float32x4_t as = vdupq_n_f32(p_conv->accel_scale);
+    const float32x4_t gs = vdupq_n_f32(p_conv->gyro_scale);
+    const uint8_t g0 = (uint8_t)(p_conv->gyro_offset / 2);
+    int32x4_t rows[8];
+    int16x8_t v;
+    uint32_t i;
+    uint8_t k;
+
+    for (i = 0; i + CONVERT_GROUP < count; i += CONVERT_GROUP) {
+        for (k = 0; k < CONVERT_GROUP; k++) {
+            v = static_neon_load_be16(p_frames + (i + k) * p_conv->frame_size);
+            rows[k] = vmovl_s16(vget_low_s16(v));
+            rows[k + 4] = vmovl_s16(vget_high_s16(v));
+        }
+        static_neon_transpose(&rows[0]);
+        static_neon_transpose(&rows[4]);
+
+        vst1q_f32(p_out->p_ax + i, vmulq_f32(vcvtq_f32_s32(rows[0]), as));
+        vst1q_f32(p_out->p_ay + i, vmulq_f32(vcvtq_f32_s32(rows[1]), as));
+        vst1q_f32(p_out->p_az + i, vmulq_f32(vcvtq_f32_s32(rows[2]), as));
+        vst1q_f32(p_out->p_gx + i, vmulq_f32(vcvtq_f32_s32(rows[g0]), gs));
+        vst1q_f32(p_out->p_gy + i, vmulq_f32(vcvtq_f32_s32(rows[g0 + 1]), gs));
+        vst1q_f32(p_out->p_gz + i, vmulq_f32(vcvtq_f32_s32(rows[g0 + 2]), gs));
+    }
+
+    return i;
+}
+
+#endif
+
+static uint32_t static_q16_simd(const mpu6050_convert_t *p_conv, const uint8_t *p_frames,
+                                uint32_t count, const mpu6050_soa_q16_t *p_out)
+{
+    const uint8_t g0 = (uint8_t)(p_conv->gyro_offset / 2);
+    const int32x4_t sh = vdupq_n_s32(-(int32_t)p_conv->q_shift);
+    int16_t mul[8] = {0};
+    int16x8_t kv;
+    int32x4_t rows[8];
+    int16x8_t v;
+    uint32_t i;
+    uint8_t k;
+
+    mul[0] = mul[1] = mul[2] = p_conv->accel_q_mul;
+    mul[g0] = mul[g0 + 1] = mul[g0 + 2] = p_conv->gyro_q_mul;
+    kv = vld1q_s16(mul);
+
+    for (i = 0; i + CONVERT_GROUP < count; i += CONVERT_GROUP) {
+        for (k = 0; k < CONVERT_GROUP; k++) {
+            v = static_neon_load_be16(p_frames + (i + k) * p_conv->frame_size);
+            /* 16x16->32 位长乘, 负移位量即算术右移 */
+            rows[k] = vshlq_s32(vmull_s16(vget_low_s16(v), vget_low_s16(kv)), sh);
+            rows[k + 4] = vshlq_s32(vmull_s16(vget_high_s16(v), vget_high_s16(kv)), sh);
+        }
+        static_neon_transpose(&rows[0]);
+        static_neon_transpose(&rows[4]);
+
+        vst1q_s32(p_out->p_ax + i, rows[0]);
+        vst1q_s32(p_out->p_ay + i, rows[1]);
+        vst1q_s32(p_out->p_az + i, rows[2]);
+        vst1q_s32(p_out->p_gx + i, rows[g0]);
+        vst1q_s32(p_out->p_gy + i, rows[g0 + 1]);
+        vst1q_s32(p_out->p_gz + i, rows[g0 + 2]);
+    }
+
+    return i;
+}
+
+#endif
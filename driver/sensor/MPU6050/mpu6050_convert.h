@@ -0,0 +1,132 @@
+/**
+ * @file mpu6050_convert.h
+ * @brief MPU6050 批量原始数据转换 (Batch Raw-to-Physical Conversion)
+ * @note  输入为 FIFO/数据寄存器中的大端原始帧数组, 输出为结构数组分离 (SoA) 的
+ *        浮点 (g, dps) 或 Q16.16 定点数据.
+ *        量程对应的倒数比例在初始化时预先计算, 转换循环中只有乘法, 没有除法:
+ *        - 浮点: raw * (1 / sensitivity)
+ *        - Q16.16: (raw * mul) >> shift, mul 不超过15位, 乘积在 32 位内完成,
+ *          无 FPU 的 Cortex-M0/M3 上每轴一条 MULS
+ *
+ * @section convert_simd 向量化
+ * MPU6050_CONVERT_USE_SIMD 为1 时每4帧一组向量化转换并转置为 SoA, 用于主机端离线处理日志:
+ * 编译器提供 SSE2 (x86) 时默认启用, 结果与可移植实现逐位一致.
+ * NEON (ARMv7-A/ARMv8) 实现尚未在 ARM 目标上编译验证, 默认关闭, 需显式定义为1启用.
+ * 其他平台 (包括 Cortex-M) 使用可移植实现. MPU6050_USE_FLOAT 为0时只提供 Q16.16 接口.
+ * 主机吞吐量可用 examples/mpu6050_host_bench.c 测量; 在无 FPU 的 MCU 上收益主要来自
+ * 用乘法代替软浮点除法, 以及 Q16.16 路径完全不调用浮点库.
+ */
+
+#ifndef _MPU6050_CONVERT_H_
+#define _MPU6050_CONVERT_H_
+
+#include "mpu6050_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#ifndef MPU6050_CONVERT_USE_SIMD
+#if defined(__SSE2__)
+#define MPU6050_CONVERT_USE_SIMD  1   /**< 1: 主机平台使用 SSE2/NEON 向量化实现 (默认只在 SSE2 上启用) */
+#else
+#define MPU6050_CONVERT_USE_SIMD  0
+#endif
+#endif
+
+#define MPU6050_CONVERT_Q_FRAC_BITS  16  /**< 定点输出的小数位数 (Q16.16) */
+
+/* --- 2. 数据结构 (Data Structures) --- */
+
+/**
+ * @brief 转换参数 (由 mpu6050_convert_init 预先计算)
+ */
+typedef struct {
+#if MPU6050_USE_FLOAT
+    float    accel_scale;      /**< g/LSB */
+    float    gyro_scale;       /**< dps/LSB */
+#endif
+    int16_t  accel_q_mul;      /**< Q16.16 加速度乘数 */
+    int16_t  gyro_q_mul;       /**< Q16.16 角速度乘数 */
+    uint8_t  q_shift;          /**< Q16.16 乘积右移位数 */
+    uint8_t  frame_size;       /**< 帧长: 12 (Accel+Gyro) 或 14 (Accel+Temp+Gyro) */
+    uint8_t  gyro_offset;      /**< 帧内陀螺仪数据的字节偏移 */
+    bool     is_initialized;   /**< 初始化标志 */
+} mpu6050_convert_t;
+
+#if MPU6050_USE_FLOAT
+/**
+ * @brief 浮点 SoA 输出 (每个指针指向长度不小于 count 的数组)
+ */
+typedef struct {
+    float *p_ax;   /**< 加速度 X (g) */
+    float *p_ay;   /**< 加速度 Y (g) */
+    float *p_az;   /**< 加速度 Z (g) */
+    float *p_gx;   /**< 角速度 X (dps) */
+    float *p_gy;   /**< 角速度 Y (dps) */
+    float *p_gz;   /**< 角速度 Z (dps) */
+} mpu6050_soa_f32_t;
+#endif
+
+/**
+ * @brief Q16.16 定点 SoA 输出 (每个指针指向长度不小于 count 的数组)
+ */
+typedef struct {
+    int32_t *p_ax;  /**< 加速度 X (g, Q16.16) */
+    int32_t *p_ay;  /**< 加速度 Y (g, Q16.16) */
+    int32_t *p_az;  /**< 加速度 Z (g, Q16.16) */
+    int32_t *p_gx;  /**< 角速度 X (dps, Q16.16) */
+    int32_t *p_gy;  /**< 角速度 Y (dps, Q16.16) */
+    int32_t *p_gz;  /**< 角速度 Z (dps, Q16.16) */
+} mpu6050_soa_q16_t;
+
+/* --- 3. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 根据设备当前量程预先计算转换参数
+ * @param p_conv 转换参数对象指针
+ * @param p_dev 已初始化的设备句柄 (读取其灵敏度)
+ * @param sensors 原始帧包含的传感器 (MPU6050_FIFO_xxx), 必须包含 ACCEL 与完整的 GYRO,
+ *                TEMP 可选; 数据寄存器 (14字节) 布局对应三者全选
+ * @return driver_status_t
+ * @note  量程改变后需重新调用
+ */
+driver_status_t mpu6050_convert_init(mpu6050_convert_t *p_conv,
+                                     const mpu6050_dev_t *p_dev,
+                                     uint8_t sensors);
+
+#if MPU6050_USE_FLOAT
+/**
+ * @brief 批量转换为浮点物理量
+ * @param p_conv 转换参数对象指针
+ * @param p_frames 原始帧数组 (大端, 帧长 frame_size)
+ * @param count 帧数
+ * @param p_out SoA 输出
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_convert_f32(const mpu6050_convert_t *p_conv,
+                                    const uint8_t *p_frames,
+                                    uint32_t count,
+                                    const mpu6050_soa_f32_t *p_out);
+#endif
+
+/**
+ * @brief 批量转换为 Q16.16 定点物理量
+ * @param p_conv 转换参数对象指针
+ * @param p_frames 原始帧数组 (大端, 帧长 frame_size)
+ * @param count 帧数
+ * @param p_out SoA 输出
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_convert_q16(const mpu6050_convert_t *p_conv,
+                                    const uint8_t *p_frames,
+                                    uint32_t count,
+                                    const mpu6050_soa_q16_t *p_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MPU6050_CONVERT_H_ */
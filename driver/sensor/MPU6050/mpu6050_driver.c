@@ -5,18 +5,29 @@
  */
 
 #include "mpu6050_driver.h"
+#include <string.h>
 
 /* --- 1. 私有宏定义 (Private Macros) --- */
 
 /* 寄存器地址 */
+#define MPU6050_REG_XA_OFFS_H       0x06
+#define MPU6050_REG_XG_OFFS_USRH    0x13
 #define MPU6050_REG_SMPLRT_DIV      0x19
 #define MPU6050_REG_CONFIG          0x1A
 #define MPU6050_REG_GYRO_CONFIG     0x1B
 #define MPU6050_REG_ACCEL_CONFIG    0x1C
+#define MPU6050_REG_MOT_THR         0x1F  /**< MOT_DUR (0x20) 紧随其后 */
+#define MPU6050_REG_FIFO_EN         0x23
+#define MPU6050_REG_INT_PIN_CFG     0x37
+#define MPU6050_REG_INT_ENABLE      0x38
+#define MPU6050_REG_INT_STATUS      0x3A
 #define MPU6050_REG_ACCEL_XOUT_H    0x3B
 #define MPU6050_REG_TEMP_OUT_H      0x41
 #define MPU6050_REG_GYRO_XOUT_H     0x43
+#define MPU6050_REG_USER_CTRL       0x6A
 #define MPU6050_REG_PWR_MGMT_1      0x6B
+#define MPU6050_REG_FIFO_COUNTH     0x72
+#define MPU6050_REG_FIFO_R_W        0x74
 #define MPU6050_REG_WHO_AM_I        0x75
 
 /* 寄存器位掩码 */
@@ -24,12 +35,109 @@
 #define MPU6050_PWR1_DEVICE_RESET   0x80
 #define MPU6050_PWR1_SLEEP          0x40
 #define MPU6050_PWR1_CLKSEL_PLL_X   0x01
+#define MPU6050_PWR1_CLKSEL_INTERNAL 0x00
+#define MPU6050_PWR1_CYCLE          0x20
+#define MPU6050_PWR1_TEMP_DIS       0x08
+#define MPU6050_PWR2_LP_WAKE_SHIFT  6
+#define MPU6050_PWR2_STBY_ACCEL     0x38  /**< STBY_XA | STBY_YA | STBY_ZA */
+#define MPU6050_PWR2_STBY_GYRO      0x07  /**< STBY_XG | STBY_YG | STBY_ZG */
+#define MPU6050_CONFIG_DLPF_MASK    0x07
+#define MPU6050_FS_SEL_MASK         0x18
+#define MPU6050_FS_SEL_SHIFT        3
+#define MPU6050_ACCEL_HPF_MASK      0x07
+#define MPU6050_ACCEL_HPF_RESET     0x00  /**< 高通滤波器关闭 (复位值) */
+#define MPU6050_ACCEL_HPF_HOLD      0x07  /**< 锁存当前样本, 输出为相对锁存值的变化 */
+#define MPU6050_MOT_THR_LSB_MG      2
+#define MPU6050_USER_FIFO_EN        0x40
+#define MPU6050_USER_FIFO_RESET     0x04
+#define MPU6050_INT_FIFO_OFLOW      0x10
+#define MPU6050_INT_DATA_RDY        0x01
+#define MPU6050_INT_MOT             0x40
+#define MPU6050_INT_PIN_ACTIVE_HIGH_PULSE 0x00  /**< 高电平有效, 推挽, 50us脉冲 */
+#define MPU6050_EXTI_TRIGGER_RISING 0
+#define MPU6050_ACCEL_OFFS_RESERVED 0x01  /**< XA/YA/ZA_OFFS 低字节 bit0 为保留位 */
 
-/* --- 2. 私有辅助函数声明 (Private Function Prototypes) --- */
+#define MPU6050_FIFO_SENSOR_MASK    (MPU6050_FIFO_TEMP | MPU6050_FIFO_GYRO | MPU6050_FIFO_ACCEL)
+#define MPU6050_FIFO_FRAME_MAX      14
+
+/* 影子寄存器下标 (shadow_cfg 对应 0x19 ~ 0x1C, shadow_pwr 对应 0x6B ~ 0x6C) */
+#define MPU6050_SHADOW_SMPLRT_DIV   0
+#define MPU6050_SHADOW_CONFIG       1
+#define MPU6050_SHADOW_GYRO_CONFIG  2
+#define MPU6050_SHADOW_ACCEL_CONFIG 3
+#define MPU6050_SHADOW_PWR_MGMT_1   0
+#define MPU6050_SHADOW_PWR_MGMT_2   1
+
+/* 整数转换: 四舍五入的乘法-移位 */
+#define MPU6050_SCALE(raw, p_scale) \
+    ((int32_t)(((int32_t)(raw) * (p_scale)->mul + (1L << ((p_scale)->shift - 1))) >> (p_scale)->shift))
+
+/* 温度 0.01C = raw / 3.4 + 3653, 1/3.4 以 Q16 乘数 19275 表示 */
+#define MPU6050_TEMP_CDEG_MUL       19275
+#define MPU6050_TEMP_CDEG_SHIFT     16
+#define MPU6050_TEMP_CDEG_OFFSET    3653
+
+/* --- 2. 私有类型与常量表 (Private Types & Tables) --- */
+
+/**
+ * @brief 整数转换系数: value = raw * mul >> shift
+ */
+typedef struct {
+    int32_t mul;
+    uint8_t shift;
+} mpu6050_scale_t;
+
+/* 按量程索引的灵敏度 (LSB/g) */
+static const uint16_t s_accel_sensitivity[4] = { 16384, 8192, 4096, 2048 };
+
+#if MPU6050_USE_FLOAT
+/* 按量程索引的灵敏度 (LSB/dps) */
+static const float s_gyro_sensitivity[4] = { 131.0f, 65.5f, 32.8f, 16.4f };
+#endif
+
+/* 按量程索引的灵敏度 x10 (LSB/dps), 与 s_gyro_sensitivity 对应; 供融合与批量转换模块使用 */
+const uint16_t g_mpu6050_gyro_lsb_x10[4] = { 1310, 655, 328, 164 };
+
+/* 低功耗循环唤醒周期 (us) 与典型电流 (uA), 按 mpu6050_wake_rate_t 索引 */
+static const uint32_t s_wake_period_us[4] = { 800000, 200000, 50000, 25000 };
+static const uint16_t s_cycle_current_ua[4] = { 10, 20, 70, 140 };
+
+/* NORMAL ~ SLEEP 的典型电流 (uA), 按 mpu6050_power_mode_t 索引; 循环模式查 s_cycle_current_ua */
+static const uint16_t s_power_current_ua[4] = { 3900, 500, 3600, 5 };
+
+/* mg: 灵敏度为2的幂, 1000 / 2^(14-fs) 可精确表示 */
+static const mpu6050_scale_t s_accel_mg_scale[4] = {
+    { 1000, 14 }, { 1000, 13 }, { 1000, 12 }, { 1000, 11 }
+};
+
+/* mdps: mul = round(1000 / (LSB/dps) * 2^shift), 取 mul < 2^16 的最大移位, 乘积不超过 int32 */
+static const mpu6050_scale_t s_gyro_mdps_scale[4] = {
+    { 62534, 13 }, { 62534, 12 }, { 62439, 11 }, { 62439, 10 }
+};
+
+/* --- 3. 私有辅助函数声明 (Private Function Prototypes) --- */
 static driver_status_t static_write_reg(mpu6050_dev_t *p_dev, uint8_t reg, uint8_t data);
 static driver_status_t static_read_regs(mpu6050_dev_t *p_dev, uint8_t reg, uint8_t *p_data, uint32_t len);
+static driver_status_t static_write_regs(mpu6050_dev_t *p_dev, uint8_t reg, const uint8_t *p_data, uint32_t len);
+static driver_status_t static_update_shadow(mpu6050_dev_t *p_dev, uint8_t reg, uint8_t *p_shadow,
+                                            const uint8_t *p_value, uint8_t len);
+static void static_reset_shadow(mpu6050_dev_t *p_dev);
+static driver_status_t static_write_config(mpu6050_dev_t *p_dev, const mpu6050_config_t *p_cfg);
+static driver_status_t static_write_power(mpu6050_dev_t *p_dev, mpu6050_power_mode_t mode);
+static driver_status_t static_read_vector(mpu6050_dev_t *p_dev, uint8_t reg, mpu6050_raw_data_t *p_vec);
+static driver_status_t static_fifo_restart(mpu6050_dev_t *p_dev, bool enable);
+static void static_fifo_decode(const mpu6050_dev_t *p_dev, mpu6050_fifo_sample_t *p_samples, uint16_t count);
+static void static_decode_frame(const uint8_t *p_buf, mpu6050_fifo_sample_t *p_out);
+static void static_apply_fs(mpu6050_dev_t *p_dev, mpu6050_gyro_fs_t gyro_fs, mpu6050_accel_fs_t accel_fs);
+static int32_t static_temp_to_cdeg(int16_t raw);
+static void static_drdy_isr(void *user_data);
+static void static_drdy_done(void *user_data, driver_status_t status);
+static driver_status_t static_set_accel_hpf(mpu6050_dev_t *p_dev, uint8_t hpf);
+static void static_wom_restore(mpu6050_dev_t *p_dev, const uint8_t *p_pwr, uint8_t accel_cfg,
+                               mpu6050_wake_rate_t wake_rate);
+static void static_wom_isr(void *user_data);
 
-/* --- 3. API 实现 (API Implementation) --- */
+/* --- 4. API 实现 (API Implementation) --- */
 
 driver_status_t mpu6050_init(mpu6050_dev_t *p_dev, 
                              const driver_i2c_ops_t *p_i2c_ops, 
@@ -45,6 +153,10 @@ driver_status_t mpu6050_init(mpu6050_dev_t *p_dev,
     if (p_i2c_ops->write_reg == NULL || p_i2c_ops->read_reg == NULL || p_time_ops->delay_ms == NULL) {
         return DRV_ERR_NOT_SUPPORT;
     }
+    if (p_cfg->gyro_fs > MPU6050_GYRO_FS_2000 || p_cfg->accel_fs > MPU6050_ACCEL_FS_16 ||
+        p_cfg->dlpf_cfg > MPU6050_DLPF_BW_5) {
+        return DRV_ERR_INVALID_VAL;
+    }
 
     /* 2. 对象初始化 */
     p_dev->i2c_ops = *p_i2c_ops;
@@ -52,6 +164,12 @@ driver_status_t mpu6050_init(mpu6050_dev_t *p_dev,
     p_dev->bus_ctx = bus_ctx;
     p_dev->dev_addr = addr;
     p_dev->is_initialized = false;
+    p_dev->fifo_sensors = 0;
+    p_dev->fifo_frame_size = 0;
+    p_dev->fifo_overflow_count = 0;
+    memset(&p_dev->drdy, 0, sizeof(mpu6050_drdy_t));
+    memset(&p_dev->wom, 0, sizeof(mpu6050_wom_t));
+    p_dev->wake_rate = MPU6050_WAKE_1_25HZ;
 
     /* 3. 复位设备 */
     if (mpu6050_reset(p_dev) != DRV_OK) {
@@ -70,51 +188,16 @@ driver_status_t mpu6050_init(mpu6050_dev_t *p_dev,
     }
 
     /* 5. 解除休眠并设置时钟源 (PLL with X axis gyro reference) */
-    if (static_write_reg(p_dev, MPU6050_REG_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_PLL_X) != DRV_OK) {
+    if (static_write_power(p_dev, MPU6050_POWER_NORMAL) != DRV_OK) {
         return DRV_ERR_IO;
     }
     p_dev->time_ops.delay_ms(10);
 
-    /* 6. 配置采样率分频 */
-    if (static_write_reg(p_dev, MPU6050_REG_SMPLRT_DIV, p_cfg->sample_rate_div) != DRV_OK) {
-        return DRV_ERR_IO;
-    }
-
-    /* 7. 配置 DLPF */
-    if (static_write_reg(p_dev, MPU6050_REG_CONFIG, p_cfg->dlpf_cfg) != DRV_OK) {
-        return DRV_ERR_IO;
-    }
-
-    /* 8. 配置陀螺仪量程 */
-    uint8_t gyro_config = (p_cfg->gyro_fs << 3);
-    if (static_write_reg(p_dev, MPU6050_REG_GYRO_CONFIG, gyro_config) != DRV_OK) {
-        return DRV_ERR_IO;
-    }
-    
-    /* 更新灵敏度 */
-    switch (p_cfg->gyro_fs) {
-        case MPU6050_GYRO_FS_250:  p_dev->gyro_sensitivity = 131.0f; break;
-        case MPU6050_GYRO_FS_500:  p_dev->gyro_sensitivity = 65.5f; break;
-        case MPU6050_GYRO_FS_1000: p_dev->gyro_sensitivity = 32.8f; break;
-        case MPU6050_GYRO_FS_2000: p_dev->gyro_sensitivity = 16.4f; break;
-        default: p_dev->gyro_sensitivity = 131.0f; break;
-    }
-
-    /* 9. 配置加速度计量程 */
-    uint8_t accel_config = (p_cfg->accel_fs << 3);
-    if (static_write_reg(p_dev, MPU6050_REG_ACCEL_CONFIG, accel_config) != DRV_OK) {
+    /* 6. 配置采样率分频、DLPF 与量程 (0x19 ~ 0x1C 一次写入), 同时更新量程与灵敏度 */
+    if (static_write_config(p_dev, p_cfg) != DRV_OK) {
         return DRV_ERR_IO;
     }
 
-    /* 更新灵敏度 */
-    switch (p_cfg->accel_fs) {
-        case MPU6050_ACCEL_FS_2:  p_dev->accel_sensitivity = 16384; break;
-        case MPU6050_ACCEL_FS_4:  p_dev->accel_sensitivity = 8192; break;
-        case MPU6050_ACCEL_FS_8:  p_dev->accel_sensitivity = 4096; break;
-        case MPU6050_ACCEL_FS_16: p_dev->accel_sensitivity = 2048; break;
-        default: p_dev->accel_sensitivity = 16384; break;
-    }
-
     p_dev->is_initialized = true;
     return DRV_OK;
 }
@@ -130,9 +213,13 @@ driver_status_t mpu6050_reset(mpu6050_dev_t *p_dev)
     
     /* 等待复位完成 */
     p_dev->time_ops.delay_ms(100);
+
+    /* 寄存器已恢复上电默认值 */
+    static_reset_shadow(p_dev);
     return DRV_OK;
 }
 
+#if MPU6050_USE_FLOAT
 driver_status_t mpu6050_read_accel(mpu6050_dev_t *p_dev, mpu6050_raw_data_t *p_raw, mpu6050_float_data_t *p_val)
 {
     if (p_dev == NULL || !p_dev->is_initialized) return DRV_ERR_INVALID_VAL;
@@ -252,14 +339,1046 @@ driver_status_t mpu6050_read_all(mpu6050_dev_t *p_dev,
     return DRV_OK;
 }
 
-/* --- 4. 私有辅助函数实现 (Private Functions) --- */
+#endif /* MPU6050_USE_FLOAT */
 
-static driver_status_t static_write_reg(mpu6050_dev_t *p_dev, uint8_t reg, uint8_t data)
+driver_status_t mpu6050_read_accel_mg(mpu6050_dev_t *p_dev, mpu6050_raw_data_t *p_raw, mpu6050_int_data_t *p_val)
 {
-    return p_dev->i2c_ops.write_reg(p_dev->bus_ctx, p_dev->dev_addr, reg, &data, 1);
+    mpu6050_raw_data_t raw;
+    uint8_t buf[6];
+
+    if (p_dev == NULL || !p_dev->is_initialized) return DRV_ERR_INVALID_VAL;
+
+    if (static_read_regs(p_dev, MPU6050_REG_ACCEL_XOUT_H, buf, 6) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    raw.x = (int16_t)((buf[0] << 8) | buf[1]);
+    raw.y = (int16_t)((buf[2] << 8) | buf[3]);
+    raw.z = (int16_t)((buf[4] << 8) | buf[5]);
+
+    if (p_raw) {
+        *p_raw = raw;
+    }
+    if (p_val) {
+        mpu6050_accel_to_mg(p_dev, &raw, p_val);
+    }
+
+    return DRV_OK;
 }
 
-static driver_status_t static_read_regs(mpu6050_dev_t *p_dev, uint8_t reg, uint8_t *p_data, uint32_t len)
+driver_status_t mpu6050_read_gyro_mdps(mpu6050_dev_t *p_dev, mpu6050_raw_data_t *p_raw, mpu6050_int_data_t *p_val)
 {
-    return p_dev->i2c_ops.read_reg(p_dev->bus_ctx, p_dev->dev_addr, reg, p_data, len);
+    mpu6050_raw_data_t raw;
+    uint8_t buf[6];
+
+    if (p_dev == NULL || !p_dev->is_initialized) return DRV_ERR_INVALID_VAL;
+
+    if (static_read_regs(p_dev, MPU6050_REG_GYRO_XOUT_H, buf, 6) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    raw.x = (int16_t)((buf[0] << 8) | buf[1]);
+    raw.y = (int16_t)((buf[2] << 8) | buf[3]);
+    raw.z = (int16_t)((buf[4] << 8) | buf[5]);
+
+    if (p_raw) {
+        *p_raw = raw;
+    }
+    if (p_val) {
+        mpu6050_gyro_to_mdps(p_dev, &raw, p_val);
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_read_temp_cdeg(mpu6050_dev_t *p_dev, int32_t *p_temp)
+{
+    uint8_t buf[2];
+
+    if (p_dev == NULL || !p_dev->is_initialized) return DRV_ERR_INVALID_VAL;
+
+    if (static_read_regs(p_dev, MPU6050_REG_TEMP_OUT_H, buf, 2) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    if (p_temp) {
+        *p_temp = static_temp_to_cdeg((int16_t)((buf[0] << 8) | buf[1]));
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_read_all_int(mpu6050_dev_t *p_dev,
+                                     mpu6050_int_data_t *p_accel,
+                                     mpu6050_int_data_t *p_gyro,
+                                     int32_t *p_temp)
+{
+    mpu6050_fifo_sample_t sample;
+    uint8_t buf[14];
+
+    if (p_dev == NULL || !p_dev->is_initialized) return DRV_ERR_INVALID_VAL;
+
+    /* 连续读取14个字节: Accel(6) + Temp(2) + Gyro(6) */
+    if (static_read_regs(p_dev, MPU6050_REG_ACCEL_XOUT_H, buf, 14) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    static_decode_frame(buf, &sample);
+
+    if (p_accel) {
+        mpu6050_accel_to_mg(p_dev, &sample.accel, p_accel);
+    }
+    if (p_temp) {
+        *p_temp = static_temp_to_cdeg(sample.temp);
+    }
+    if (p_gyro) {
+        mpu6050_gyro_to_mdps(p_dev, &sample.gyro, p_gyro);
+    }
+
+    return DRV_OK;
+}
+
+void mpu6050_accel_to_mg(const mpu6050_dev_t *p_dev, const mpu6050_raw_data_t *p_raw, mpu6050_int_data_t *p_val)
+{
+    const mpu6050_scale_t *p_scale = &s_accel_mg_scale[p_dev->accel_fs];
+
+    p_val->x = MPU6050_SCALE(p_raw->x, p_scale);
+    p_val->y = MPU6050_SCALE(p_raw->y, p_scale);
+    p_val->z = MPU6050_SCALE(p_raw->z, p_scale);
+}
+
+void mpu6050_gyro_to_mdps(const mpu6050_dev_t *p_dev, const mpu6050_raw_data_t *p_raw, mpu6050_int_data_t *p_val)
+{
+    const mpu6050_scale_t *p_scale = &s_gyro_mdps_scale[p_dev->gyro_fs];
+
+    p_val->x = MPU6050_SCALE(p_raw->x, p_scale);
+    p_val->y = MPU6050_SCALE(p_raw->y, p_scale);
+    p_val->z = MPU6050_SCALE(p_raw->z, p_scale);
+}
+
+driver_status_t mpu6050_configure(mpu6050_dev_t *p_dev, const mpu6050_config_t *p_cfg)
+{
+    if (p_dev == NULL || !p_dev->is_initialized || p_cfg == NULL) return DRV_ERR_INVALID_VAL;
+
+    if (p_cfg->gyro_fs > MPU6050_GYRO_FS_2000 || p_cfg->accel_fs > MPU6050_ACCEL_FS_16 ||
+        p_cfg->dlpf_cfg > MPU6050_DLPF_BW_5) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    return static_write_config(p_dev, p_cfg);
+}
+
+driver_status_t mpu6050_get_config(const mpu6050_dev_t *p_dev, mpu6050_config_t *p_cfg)
+{
+    if (p_dev == NULL || !p_dev->is_initialized || p_cfg == NULL) return DRV_ERR_INVALID_VAL;
+
+    p_cfg->gyro_fs = p_dev->gyro_fs;
+    p_cfg->accel_fs = p_dev->accel_fs;
+    p_cfg->dlpf_cfg = (mpu6050_dlpf_cfg_t)(p_dev->shadow_cfg[MPU6050_SHADOW_CONFIG] & MPU6050_CONFIG_DLPF_MASK);
+    p_cfg->sample_rate_div = p_dev->shadow_cfg[MPU6050_SHADOW_SMPLRT_DIV];
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_set_fs(mpu6050_dev_t *p_dev, mpu6050_gyro_fs_t gyro_fs, mpu6050_accel_fs_t accel_fs)
+{
+    mpu6050_config_t cfg;
+
+    if (mpu6050_get_config(p_dev, &cfg) != DRV_OK) return DRV_ERR_INVALID_VAL;
+
+    cfg.gyro_fs = gyro_fs;
+    cfg.accel_fs = accel_fs;
+    return mpu6050_configure(p_dev, &cfg);
+}
+
+driver_status_t mpu6050_set_gyro_fs(mpu6050_dev_t *p_dev, mpu6050_gyro_fs_t gyro_fs)
+{
+    mpu6050_config_t cfg;
+
+    if (mpu6050_get_config(p_dev, &cfg) != DRV_OK) return DRV_ERR_INVALID_VAL;
+
+    cfg.gyro_fs = gyro_fs;
+    return mpu6050_configure(p_dev, &cfg);
+}
+
+driver_status_t mpu6050_set_accel_fs(mpu6050_dev_t *p_dev, mpu6050_accel_fs_t accel_fs)
+{
+    mpu6050_config_t cfg;
+
+    if (mpu6050_get_config(p_dev, &cfg) != DRV_OK) return DRV_ERR_INVALID_VAL;
+
+    cfg.accel_fs = accel_fs;
+    return mpu6050_configure(p_dev, &cfg);
+}
+
+driver_status_t mpu6050_set_dlpf(mpu6050_dev_t *p_dev, mpu6050_dlpf_cfg_t dlpf_cfg)
+{
+    mpu6050_config_t cfg;
+
+    if (mpu6050_get_config(p_dev, &cfg) != DRV_OK) return DRV_ERR_INVALID_VAL;
+
+    cfg.dlpf_cfg = dlpf_cfg;
+    return mpu6050_configure(p_dev, &cfg);
+}
+
+driver_status_t mpu6050_set_sample_rate_div(mpu6050_dev_t *p_dev, uint8_t sample_rate_div)
+{
+    mpu6050_config_t cfg;
+
+    if (mpu6050_get_config(p_dev, &cfg) != DRV_OK) return DRV_ERR_INVALID_VAL;
+
+    cfg.sample_rate_div = sample_rate_div;
+    return mpu6050_configure(p_dev, &cfg);
+}
+
+driver_status_t mpu6050_set_power_mode(mpu6050_dev_t *p_dev, mpu6050_power_mode_t mode)
+{
+    if (p_dev == NULL || !p_dev->is_initialized || mode > MPU6050_POWER_CYCLE) return DRV_ERR_INVALID_VAL;
+
+    return static_write_power(p_dev, mode);
+}
+
+driver_status_t mpu6050_set_wake_rate(mpu6050_dev_t *p_dev, mpu6050_wake_rate_t rate)
+{
+    if (p_dev == NULL || !p_dev->is_initialized || rate > MPU6050_WAKE_40HZ) return DRV_ERR_INVALID_VAL;
+
+    p_dev->wake_rate = rate;
+    if (p_dev->shadow_pwr[MPU6050_SHADOW_PWR_MGMT_1] & MPU6050_PWR1_CYCLE) {
+        return static_write_power(p_dev, MPU6050_POWER_CYCLE);
+    }
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_power_estimate(mpu6050_power_mode_t mode,
+                                       mpu6050_wake_rate_t rate,
+                                       mpu6050_power_estimate_t *p_est)
+{
+    uint32_t active_ua = s_power_current_ua[MPU6050_POWER_ACCEL_ONLY];
+    uint32_t sleep_ua = s_power_current_ua[MPU6050_POWER_SLEEP];
+
+    if (p_est == NULL || mode > MPU6050_POWER_CYCLE || rate > MPU6050_WAKE_40HZ) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    switch (mode) {
+        case MPU6050_POWER_CYCLE:
+            /* 每次唤醒加速度计以正常电流工作一段时间, 其余时间为休眠电流 */
+            p_est->current_ua = s_cycle_current_ua[rate];
+            p_est->duty_permille = (uint16_t)(((p_est->current_ua - sleep_ua) * 1000U +
+                                               (active_ua - sleep_ua) / 2U) / (active_ua - sleep_ua));
+            break;
+        case MPU6050_POWER_SLEEP:
+            p_est->current_ua = sleep_ua;
+            p_est->duty_permille = 0;
+            break;
+        default:
+            p_est->current_ua = s_power_current_ua[mode];
+            p_est->duty_permille = 1000;
+            break;
+    }
+
+    return DRV_OK;
+}
+
+uint32_t mpu6050_get_sample_period_us(const mpu6050_dev_t *p_dev)
+{
+    uint8_t dlpf_cfg;
+    uint32_t base_period_us;
+
+    if (p_dev == NULL || !p_dev->is_initialized) return 0;
+
+    if (p_dev->shadow_pwr[MPU6050_SHADOW_PWR_MGMT_1] & MPU6050_PWR1_CYCLE) {
+        return s_wake_period_us[p_dev->wake_rate];
+    }
+
+    /* DLPF_CFG 为 0 或 7 (DLPF 关闭) 时陀螺仪输出率 8kHz (125us), 否则 1kHz */
+    dlpf_cfg = p_dev->shadow_cfg[MPU6050_SHADOW_CONFIG] & MPU6050_CONFIG_DLPF_MASK;
+    base_period_us = (dlpf_cfg == 0 || dlpf_cfg == 7) ? 125U : 1000U;
+    return base_period_us * (1U + p_dev->shadow_cfg[MPU6050_SHADOW_SMPLRT_DIV]);
+}
+
+driver_status_t mpu6050_get_gyro_offset(mpu6050_dev_t *p_dev, mpu6050_raw_data_t *p_offset)
+{
+    if (p_dev == NULL || !p_dev->is_initialized || p_offset == NULL) return DRV_ERR_INVALID_VAL;
+
+    return static_read_vector(p_dev, MPU6050_REG_XG_OFFS_USRH, p_offset);
+}
+
+driver_status_t mpu6050_set_gyro_offset(mpu6050_dev_t *p_dev, const mpu6050_raw_data_t *p_offset)
+{
+    uint8_t buf[6];
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_offset == NULL) return DRV_ERR_INVALID_VAL;
+
+    buf[0] = DRV_U16_HIGH(p_offset->x);
+    buf[1] = DRV_U16_LOW(p_offset->x);
+    buf[2] = DRV_U16_HIGH(p_offset->y);
+    buf[3] = DRV_U16_LOW(p_offset->y);
+    buf[4] = DRV_U16_HIGH(p_offset->z);
+    buf[5] = DRV_U16_LOW(p_offset->z);
+
+    /* XG_OFFS_USRH ~ ZG_OFFS_USRL 地址连续, 一次写入 */
+    if (static_write_regs(p_dev, MPU6050_REG_XG_OFFS_USRH, buf, 6) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_get_accel_offset(mpu6050_dev_t *p_dev, mpu6050_raw_data_t *p_offset)
+{
+    if (p_dev == NULL || !p_dev->is_initialized || p_offset == NULL) return DRV_ERR_INVALID_VAL;
+
+    return static_read_vector(p_dev, MPU6050_REG_XA_OFFS_H, p_offset);
+}
+
+driver_status_t mpu6050_set_accel_offset(mpu6050_dev_t *p_dev, const mpu6050_raw_data_t *p_offset)
+{
+    uint8_t buf[6];
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_offset == NULL) return DRV_ERR_INVALID_VAL;
+
+    /* 读回原值以保留各低字节的 bit0 */
+    if (static_read_regs(p_dev, MPU6050_REG_XA_OFFS_H, buf, 6) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    buf[0] = DRV_U16_HIGH(p_offset->x);
+    buf[1] = (uint8_t)((DRV_U16_LOW(p_offset->x) & ~MPU6050_ACCEL_OFFS_RESERVED) |
+                       (buf[1] & MPU6050_ACCEL_OFFS_RESERVED));
+    buf[2] = DRV_U16_HIGH(p_offset->y);
+    buf[3] = (uint8_t)((DRV_U16_LOW(p_offset->y) & ~MPU6050_ACCEL_OFFS_RESERVED) |
+                       (buf[3] & MPU6050_ACCEL_OFFS_RESERVED));
+    buf[4] = DRV_U16_HIGH(p_offset->z);
+    buf[5] = (uint8_t)((DRV_U16_LOW(p_offset->z) & ~MPU6050_ACCEL_OFFS_RESERVED) |
+                       (buf[5] & MPU6050_ACCEL_OFFS_RESERVED));
+
+    if (static_write_regs(p_dev, MPU6050_REG_XA_OFFS_H, buf, 6) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fifo_enable(mpu6050_dev_t *p_dev, uint8_t sensors)
+{
+    uint8_t frame_size;
+
+    if (p_dev == NULL || !p_dev->is_initialized) return DRV_ERR_INVALID_VAL;
+    if (sensors == 0 || (sensors & ~MPU6050_FIFO_SENSOR_MASK) != 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    /* 帧长: 加速度计6字节, 温度与每个陀螺仪轴各2字节 */
+    frame_size = (sensors & MPU6050_FIFO_ACCEL) ? 6 : 0;
+    if (sensors & MPU6050_FIFO_TEMP)   frame_size += 2;
+    if (sensors & MPU6050_FIFO_GYRO_X) frame_size += 2;
+    if (sensors & MPU6050_FIFO_GYRO_Y) frame_size += 2;
+    if (sensors & MPU6050_FIFO_GYRO_Z) frame_size += 2;
+
+    /* 先停止写入FIFO, 再切换传感器选择, 最后清空并重新使能 */
+    if (static_fifo_restart(p_dev, false) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+    if (static_write_reg(p_dev, MPU6050_REG_FIFO_EN, sensors) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+    if (static_fifo_restart(p_dev, true) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    p_dev->fifo_sensors = sensors;
+    p_dev->fifo_frame_size = frame_size;
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fifo_disable(mpu6050_dev_t *p_dev)
+{
+    if (p_dev == NULL || !p_dev->is_initialized) return DRV_ERR_INVALID_VAL;
+
+    if (static_fifo_restart(p_dev, false) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+    if (static_write_reg(p_dev, MPU6050_REG_FIFO_EN, 0) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    p_dev->fifo_sensors = 0;
+    p_dev->fifo_frame_size = 0;
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fifo_reset(mpu6050_dev_t *p_dev)
+{
+    if (p_dev == NULL || !p_dev->is_initialized || p_dev->fifo_sensors == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (static_fifo_restart(p_dev, true) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fifo_get_count(mpu6050_dev_t *p_dev, uint16_t *p_count)
+{
+    uint8_t buf[2];
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_dev->fifo_sensors == 0 || p_count == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (static_read_regs(p_dev, MPU6050_REG_FIFO_COUNTH, buf, 2) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    *p_count = (uint16_t)(DRV_MAKE_U16(buf[0], buf[1]) / p_dev->fifo_frame_size);
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fifo_read(mpu6050_dev_t *p_dev,
+                                  mpu6050_fifo_sample_t *p_samples,
+                                  uint16_t max_count,
+                                  uint16_t *p_count)
+{
+    driver_status_t status;
+
+    /* 原始帧直接读入样本数组, 再原地解码 */
+    status = mpu6050_fifo_read_raw(p_dev, (uint8_t *)p_samples, max_count, p_count);
+    if (status != DRV_OK) {
+        return status;
+    }
+
+    static_fifo_decode(p_dev, p_samples, *p_count);
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fifo_read_raw(mpu6050_dev_t *p_dev,
+                                      uint8_t *p_frames,
+                                      uint16_t max_count,
+                                      uint16_t *p_count)
+{
+    uint8_t buf[2];
+    uint16_t bytes;
+    uint16_t frames;
+    bool overflow;
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_dev->fifo_sensors == 0 ||
+        p_frames == NULL || p_count == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    *p_count = 0;
+
+    if (static_read_regs(p_dev, MPU6050_REG_FIFO_COUNTH, buf, 2) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+    bytes = DRV_MAKE_U16(buf[0], buf[1]);
+
+    /* 积压超过一半时才查询溢出标志, 正常情况下不增加额外传输 */
+    if (bytes > MPU6050_FIFO_SIZE / 2) {
+        if (static_read_regs(p_dev, MPU6050_REG_INT_STATUS, buf, 1) != DRV_OK) {
+            return DRV_ERR_IO;
+        }
+        overflow = (buf[0] & MPU6050_INT_FIFO_OFLOW) != 0 || bytes >= MPU6050_FIFO_SIZE;
+
+        /* 溢出后最旧的字节被覆盖, 帧边界错位: 只能清空重新对齐 */
+        if (overflow) {
+            if (static_fifo_restart(p_dev, true) != DRV_OK) {
+                return DRV_ERR_IO;
+            }
+            p_dev->fifo_overflow_count++;
+            return DRV_ERR_NO_MEM;
+        }
+    }
+
+    frames = (uint16_t)(bytes / p_dev->fifo_frame_size);
+    if (frames > max_count) {
+        frames = max_count;
+    }
+    if (frames == 0) {
+        return DRV_OK;
+    }
+
+    /* 一次传输读出全部完整帧; 不足一帧的尾部留在FIFO中待下次读取 */
+    if (static_read_regs(p_dev, MPU6050_REG_FIFO_R_W, p_frames,
+                         (uint32_t)frames * p_dev->fifo_frame_size) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    *p_count = frames;
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fifo_read_frames(mpu6050_dev_t *p_dev,
+                                         mpu6050_fifo_sample_t *p_samples,
+                                         uint16_t count)
+{
+    if (p_dev == NULL || !p_dev->is_initialized || p_dev->fifo_sensors == 0 || p_samples == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+    if (count == 0) {
+        return DRV_OK;
+    }
+
+    if (static_read_regs(p_dev, MPU6050_REG_FIFO_R_W, (uint8_t *)p_samples,
+                         (uint32_t)count * p_dev->fifo_frame_size) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    static_fifo_decode(p_dev, p_samples, count);
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_drdy_start(mpu6050_dev_t *p_dev,
+                                   const driver_exti_ops_t *p_exti_ops,
+                                   void *exti_ctx,
+                                   uint8_t pin_num,
+                                   mpu6050_sample_callback_t cb,
+                                   void *user_data)
+{
+    mpu6050_drdy_t *p_drdy;
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_exti_ops == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+    if (p_exti_ops->enable == NULL || p_dev->i2c_ops.read_reg_async == NULL) {
+        return DRV_ERR_NOT_SUPPORT;
+    }
+    /* 停止前发起的异步读取仍可能写入缓冲区, 完成前不能复位采集状态 */
+    if (p_dev->drdy.is_active || p_dev->drdy.is_busy || p_dev->wom.is_active) {
+        return DRV_ERR_BUSY;
+    }
+
+    p_drdy = &p_dev->drdy;
+    memset(p_drdy, 0, sizeof(mpu6050_drdy_t));
+    p_drdy->exti_ops = *p_exti_ops;
+    p_drdy->exti_ctx = exti_ctx;
+    p_drdy->pin_num = pin_num;
+    p_drdy->cb = cb;
+    p_drdy->user_data = user_data;
+
+    /* 先配置引脚并注册处理函数, 最后使能中断源, 第一个脉冲不会丢失 */
+    if (static_write_reg(p_dev, MPU6050_REG_INT_PIN_CFG, MPU6050_INT_PIN_ACTIVE_HIGH_PULSE) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    p_drdy->is_active = true;
+    if (p_exti_ops->enable(exti_ctx, pin_num, MPU6050_EXTI_TRIGGER_RISING, static_drdy_isr, p_dev) != DRV_OK) {
+        p_drdy->is_active = false;
+        return DRV_ERR_IO;
+    }
+
+    if (static_write_reg(p_dev, MPU6050_REG_INT_ENABLE, MPU6050_INT_DATA_RDY) != DRV_OK) {
+        mpu6050_drdy_stop(p_dev);
+        return DRV_ERR_IO;
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_drdy_stop(mpu6050_dev_t *p_dev)
+{
+    driver_status_t status;
+
+    if (p_dev == NULL || !p_dev->is_initialized) return DRV_ERR_INVALID_VAL;
+    if (!p_dev->drdy.is_active) return DRV_OK;
+
+    status = static_write_reg(p_dev, MPU6050_REG_INT_ENABLE, 0);
+
+    if (p_dev->drdy.exti_ops.disable != NULL) {
+        p_dev->drdy.exti_ops.disable(p_dev->drdy.exti_ctx, p_dev->drdy.pin_num);
+    }
+    p_dev->drdy.is_active = false;
+
+    return (status == DRV_OK) ? DRV_OK : DRV_ERR_IO;
+}
+
+driver_status_t mpu6050_drdy_get_latest(mpu6050_dev_t *p_dev, mpu6050_timed_sample_t *p_sample)
+{
+    mpu6050_drdy_t *p_drdy;
+    uint32_t sequence;
+    uint8_t index;
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_sample == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_drdy = &p_dev->drdy;
+
+    /* 发布时先切换缓冲区再递增序号: 复制前后序号一致即说明数据未被改写 */
+    do {
+        sequence = p_drdy->sequence;
+        if (sequence == 0) {
+            return DRV_ERR_BUSY;
+        }
+        index = (uint8_t)(p_drdy->fill_index ^ 1U);
+        p_sample->timestamp = p_drdy->timestamp[index];
+        static_decode_frame(p_drdy->buf[index], &p_sample->data);
+    } while (sequence != p_drdy->sequence);
+
+    p_sample->sequence = sequence - 1U;
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_wom_start(mpu6050_dev_t *p_dev,
+                                  const mpu6050_motion_config_t *p_config,
+                                  const driver_exti_ops_t *p_exti_ops,
+                                  void *exti_ctx,
+                                  uint8_t pin_num,
+                                  mpu6050_motion_callback_t cb,
+                                  void *user_data)
+{
+    static const mpu6050_motion_config_t default_config = MPU6050_MOTION_DEFAULT_CONFIG;
+    mpu6050_wom_t *p_wom;
+    uint8_t mot[2];
+    uint16_t threshold;
+    uint8_t saved_pwr[2];
+    uint8_t saved_accel_cfg;
+    mpu6050_wake_rate_t saved_wake_rate;
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_exti_ops == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+    if (p_config == NULL) {
+        p_config = &default_config;
+    }
+    if (p_config->wake_rate > MPU6050_WAKE_40HZ || p_config->duration_ms == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+    if (p_exti_ops->enable == NULL) {
+        return DRV_ERR_NOT_SUPPORT;
+    }
+    if (p_dev->drdy.is_active || p_dev->wom.is_active) {
+        return DRV_ERR_BUSY;
+    }
+
+    /* 阈值换算为 2mg/LSB, 四舍五入并限制在 1 ~ 255 */
+    threshold = (uint16_t)((p_config->threshold_mg + MPU6050_MOT_THR_LSB_MG / 2) / MPU6050_MOT_THR_LSB_MG);
+    if (threshold == 0) {
+        threshold = 1;
+    } else if (threshold > 0xFF) {
+        threshold = 0xFF;
+    }
+    mot[0] = (uint8_t)threshold;
+    mot[1] = p_config->duration_ms;
+
+    p_wom = &p_dev->wom;
+    memset(p_wom, 0, sizeof(mpu6050_wom_t));
+    p_wom->exti_ops = *p_exti_ops;
+    p_wom->exti_ctx = exti_ctx;
+    p_wom->pin_num = pin_num;
+    p_wom->cb = cb;
+    p_wom->user_data = user_data;
+
+    /* 失败时恢复调用前的电源模式与高通滤波器 */
+    memcpy(saved_pwr, p_dev->shadow_pwr, sizeof(saved_pwr));
+    saved_accel_cfg = p_dev->shadow_cfg[MPU6050_SHADOW_ACCEL_CONFIG];
+    saved_wake_rate = p_dev->wake_rate;
+
+    /* 1. 加速度计以 1kHz 连续运行, 高通滤波器复位, 写入阈值与持续时间 */
+    if (static_write_power(p_dev, MPU6050_POWER_ACCEL_ONLY) != DRV_OK ||
+        static_set_accel_hpf(p_dev, MPU6050_ACCEL_HPF_RESET) != DRV_OK ||
+        static_write_regs(p_dev, MPU6050_REG_MOT_THR, mot, 2) != DRV_OK) {
+        static_wom_restore(p_dev, saved_pwr, saved_accel_cfg, saved_wake_rate);
+        return DRV_ERR_IO;
+    }
+
+    /* 2. 等待加速度计稳定后锁存当前姿态; 锁存前使能中断会因重力超过阈值而立即触发 */
+    p_dev->time_ops.delay_ms(MPU6050_WOM_SETTLE_MS);
+    if (static_set_accel_hpf(p_dev, MPU6050_ACCEL_HPF_HOLD) != DRV_OK ||
+        static_write_reg(p_dev, MPU6050_REG_INT_PIN_CFG, MPU6050_INT_PIN_ACTIVE_HIGH_PULSE) != DRV_OK) {
+        static_wom_restore(p_dev, saved_pwr, saved_accel_cfg, saved_wake_rate);
+        return DRV_ERR_IO;
+    }
+
+    /* 3. 先注册处理函数再使能中断源, 最后进入低功耗循环 */
+    p_wom->is_active = true;
+    if (p_exti_ops->enable(exti_ctx, pin_num, MPU6050_EXTI_TRIGGER_RISING, static_wom_isr, p_dev) != DRV_OK) {
+        p_wom->is_active = false;
+        static_wom_restore(p_dev, saved_pwr, saved_accel_cfg, saved_wake_rate);
+        return DRV_ERR_IO;
+    }
+
+    p_dev->wake_rate = p_config->wake_rate;
+    if (static_write_reg(p_dev, MPU6050_REG_INT_ENABLE, MPU6050_INT_MOT) != DRV_OK ||
+        static_write_power(p_dev, MPU6050_POWER_CYCLE) != DRV_OK) {
+        static_write_reg(p_dev, MPU6050_REG_INT_ENABLE, 0);
+        if (p_exti_ops->disable != NULL) {
+            p_exti_ops->disable(exti_ctx, pin_num);
+        }
+        p_wom->is_active = false;
+        static_wom_restore(p_dev, saved_pwr, saved_accel_cfg, saved_wake_rate);
+        return DRV_ERR_IO;
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_wom_stop(mpu6050_dev_t *p_dev)
+{
+    driver_status_t status = DRV_OK;
+
+    if (p_dev == NULL || !p_dev->is_initialized) return DRV_ERR_INVALID_VAL;
+    if (!p_dev->wom.is_active) return DRV_OK;
+
+    if (static_write_reg(p_dev, MPU6050_REG_INT_ENABLE, 0) != DRV_OK) {
+        status = DRV_ERR_IO;
+    }
+
+    if (p_dev->wom.exti_ops.disable != NULL) {
+        p_dev->wom.exti_ops.disable(p_dev->wom.exti_ctx, p_dev->wom.pin_num);
+    }
+    p_dev->wom.is_active = false;
+
+    if (static_set_accel_hpf(p_dev, MPU6050_ACCEL_HPF_RESET) != DRV_OK ||
+        static_write_power(p_dev, MPU6050_POWER_NORMAL) != DRV_OK) {
+        status = DRV_ERR_IO;
+    }
+
+    return status;
+}
+
+/* --- 5. 私有辅助函数实现 (Private Functions) --- */
+
+static driver_status_t static_write_reg(mpu6050_dev_t *p_dev, uint8_t reg, uint8_t data)
+{
+    return p_dev->i2c_ops.write_reg(p_dev->bus_ctx, p_dev->dev_addr, reg, &data, 1);
+}
+
+static driver_status_t static_read_regs(mpu6050_dev_t *p_dev, uint8_t reg, uint8_t *p_data, uint32_t len)
+{
+    return p_dev->i2c_ops.read_reg(p_dev->bus_ctx, p_dev->dev_addr, reg, p_data, len);
+}
+
+static driver_status_t static_write_regs(mpu6050_dev_t *p_dev, uint8_t reg, const uint8_t *p_data, uint32_t len)
+{
+    return p_dev->i2c_ops.write_reg(p_dev->bus_ctx, p_dev->dev_addr, reg, p_data, len);
+}
+
+/**
+ * @brief 将一组连续寄存器更新为目标值, 只写入与影子不同的最短连续区间
+ * @note  写入成功后更新影子; 失败时影子保持不变, 下次调用会重新写入
+ */
+static driver_status_t static_update_shadow(mpu6050_dev_t *p_dev, uint8_t reg, uint8_t *p_shadow,
+                                            const uint8_t *p_value, uint8_t len)
+{
+    uint8_t first = 0;
+    uint8_t last = len;
+
+    while (first < len && p_shadow[first] == p_value[first]) {
+        first++;
+    }
+    if (first == len) {
+        return DRV_OK;
+    }
+    while (p_shadow[last - 1] == p_value[last - 1]) {
+        last--;
+    }
+
+    if (static_write_regs(p_dev, (uint8_t)(reg + first), &p_value[first], (uint32_t)(last - first)) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    memcpy(&p_shadow[first], &p_value[first], last - first);
+    return DRV_OK;
+}
+
+/**
+ * @brief 影子寄存器恢复为芯片复位后的默认值
+ */
+static void static_reset_shadow(mpu6050_dev_t *p_dev)
+{
+    memset(p_dev->shadow_cfg, 0, sizeof(p_dev->shadow_cfg));
+    p_dev->shadow_pwr[MPU6050_SHADOW_PWR_MGMT_1] = MPU6050_PWR1_SLEEP;
+    p_dev->shadow_pwr[MPU6050_SHADOW_PWR_MGMT_2] = 0;
+}
+
+/**
+ * @brief 写入量程、DLPF 与采样率分频 (参数已检查)
+ */
+static driver_status_t static_write_config(mpu6050_dev_t *p_dev, const mpu6050_config_t *p_cfg)
+{
+    uint8_t regs[4];
+
+    /* 只替换本驱动管理的位域, 其余位保持影子中的值 */
+    regs[MPU6050_SHADOW_SMPLRT_DIV] = p_cfg->sample_rate_div;
+    regs[MPU6050_SHADOW_CONFIG] = (uint8_t)((p_dev->shadow_cfg[MPU6050_SHADOW_CONFIG] &
+                                             ~MPU6050_CONFIG_DLPF_MASK) | p_cfg->dlpf_cfg);
+    regs[MPU6050_SHADOW_GYRO_CONFIG] = (uint8_t)((p_dev->shadow_cfg[MPU6050_SHADOW_GYRO_CONFIG] &
+                                                  ~MPU6050_FS_SEL_MASK) | (p_cfg->gyro_fs << MPU6050_FS_SEL_SHIFT));
+    regs[MPU6050_SHADOW_ACCEL_CONFIG] = (uint8_t)((p_dev->shadow_cfg[MPU6050_SHADOW_ACCEL_CONFIG] &
+                                                   ~MPU6050_FS_SEL_MASK) | (p_cfg->accel_fs << MPU6050_FS_SEL_SHIFT));
+
+    if (static_update_shadow(p_dev, MPU6050_REG_SMPLRT_DIV, p_dev->shadow_cfg, regs, 4) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    /* 寄存器写入成功后一次性更新量程与灵敏度 */
+    static_apply_fs(p_dev, p_cfg->gyro_fs, p_cfg->accel_fs);
+
+    return DRV_OK;
+}
+
+/**
+ * @brief 写入电源模式 (参数已检查)
+ */
+static driver_status_t static_write_power(mpu6050_dev_t *p_dev, mpu6050_power_mode_t mode)
+{
+    uint8_t regs[2];
+
+    switch (mode) {
+        case MPU6050_POWER_ACCEL_ONLY:
+            /* 陀螺仪待机时 PLL 参考不可用, 改用内部振荡器 */
+            regs[MPU6050_SHADOW_PWR_MGMT_1] = MPU6050_PWR1_CLKSEL_INTERNAL;
+            regs[MPU6050_SHADOW_PWR_MGMT_2] = MPU6050_PWR2_STBY_GYRO;
+            break;
+        case MPU6050_POWER_GYRO_ONLY:
+            regs[MPU6050_SHADOW_PWR_MGMT_1] = MPU6050_PWR1_CLKSEL_PLL_X;
+            regs[MPU6050_SHADOW_PWR_MGMT_2] = MPU6050_PWR2_STBY_ACCEL;
+            break;
+        case MPU6050_POWER_SLEEP:
+            regs[MPU6050_SHADOW_PWR_MGMT_1] = MPU6050_PWR1_SLEEP | MPU6050_PWR1_CLKSEL_PLL_X;
+            regs[MPU6050_SHADOW_PWR_MGMT_2] = 0;
+            break;
+        case MPU6050_POWER_CYCLE:
+            /* CYCLE 要求 SLEEP 为0; 唤醒频率位于 PWR_MGMT_2 高两位 */
+            regs[MPU6050_SHADOW_PWR_MGMT_1] = MPU6050_PWR1_CYCLE | MPU6050_PWR1_TEMP_DIS |
+                                              MPU6050_PWR1_CLKSEL_INTERNAL;
+            regs[MPU6050_SHADOW_PWR_MGMT_2] = (uint8_t)((p_dev->wake_rate << MPU6050_PWR2_LP_WAKE_SHIFT) |
+                                                        MPU6050_PWR2_STBY_GYRO);
+            break;
+        default:
+            regs[MPU6050_SHADOW_PWR_MGMT_1] = MPU6050_PWR1_CLKSEL_PLL_X;
+            regs[MPU6050_SHADOW_PWR_MGMT_2] = 0;
+            break;
+    }
+
+    return static_update_shadow(p_dev, MPU6050_REG_PWR_MGMT_1, p_dev->shadow_pwr, regs, 2);
+}
+
+/**
+ * @brief 读取3个连续的大端16位寄存器
+ */
+static driver_status_t static_read_vector(mpu6050_dev_t *p_dev, uint8_t reg, mpu6050_raw_data_t *p_vec)
+{
+    uint8_t buf[6];
+
+    if (static_read_regs(p_dev, reg, buf, 6) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    p_vec->x = (int16_t)DRV_MAKE_U16(buf[0], buf[1]);
+    p_vec->y = (int16_t)DRV_MAKE_U16(buf[2], buf[3]);
+    p_vec->z = (int16_t)DRV_MAKE_U16(buf[4], buf[5]);
+
+    return DRV_OK;
+}
+
+/**
+ * @brief 停止FIFO写入并清空, 可选地重新使能
+ * @note  FIFO_RESET 仅在 USER_CTRL.FIFO_EN 为0时生效, 因此复位与使能分两次写入
+ */
+static driver_status_t static_fifo_restart(mpu6050_dev_t *p_dev, bool enable)
+{
+    uint8_t user_ctrl;
+
+    if (static_read_regs(p_dev, MPU6050_REG_USER_CTRL, &user_ctrl, 1) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    user_ctrl &= (uint8_t)~(MPU6050_USER_FIFO_EN | MPU6050_USER_FIFO_RESET);
+    if (static_write_reg(p_dev, MPU6050_REG_USER_CTRL, user_ctrl | MPU6050_USER_FIFO_RESET) != DRV_OK) {
+        return DRV_ERR_IO;
+    }
+
+    if (enable) {
+        return static_write_reg(p_dev, MPU6050_REG_USER_CTRL, user_ctrl | MPU6050_USER_FIFO_EN);
+    }
+    return DRV_OK;
+}
+
+/**
+ * @brief 将读入样本数组的FIFO原始帧原地解码
+ * @note  帧长不超过 sizeof(mpu6050_fifo_sample_t), 第i帧原始数据位于第i个样本之前或重叠处,
+ *        从最后一帧向前解码, 写入样本时不会覆盖尚未解码的帧
+ */
+static void static_fifo_decode(const mpu6050_dev_t *p_dev, mpu6050_fifo_sample_t *p_samples, uint16_t count)
+{
+    const uint8_t *p_raw = (const uint8_t *)p_samples;
+    uint8_t frame[MPU6050_FIFO_FRAME_MAX];
+    mpu6050_fifo_sample_t *p_out;
+    uint8_t sensors = p_dev->fifo_sensors;
+    uint8_t k;
+
+    while (count > 0) {
+        count--;
+        memcpy(frame, p_raw + (uint32_t)count * p_dev->fifo_frame_size, p_dev->fifo_frame_size);
+
+        p_out = &p_samples[count];
+        memset(p_out, 0, sizeof(mpu6050_fifo_sample_t));
+        k = 0;
+
+        /* 帧内顺序与数据寄存器顺序一致: Accel, Temp, Gyro X/Y/Z (Big Endian) */
+        if (sensors & MPU6050_FIFO_ACCEL) {
+            p_out->accel.x = (int16_t)((frame[0] << 8) | frame[1]);
+            p_out->accel.y = (int16_t)((frame[2] << 8) | frame[3]);
+            p_out->accel.z = (int16_t)((frame[4] << 8) | frame[5]);
+            k = 6;
+        }
+        if (sensors & MPU6050_FIFO_TEMP) {
+            p_out->temp = (int16_t)((frame[k] << 8) | frame[k + 1]);
+            k += 2;
+        }
+        if (sensors & MPU6050_FIFO_GYRO_X) {
+            p_out->gyro.x = (int16_t)((frame[k] << 8) | frame[k + 1]);
+            k += 2;
+        }
+        if (sensors & MPU6050_FIFO_GYRO_Y) {
+            p_out->gyro.y = (int16_t)((frame[k] << 8) | frame[k + 1]);
+            k += 2;
+        }
+        if (sensors & MPU6050_FIFO_GYRO_Z) {
+            p_out->gyro.z = (int16_t)((frame[k] << 8) | frame[k + 1]);
+        }
+    }
+}
+
+/**
+ * @brief 解码数据寄存器顺序的14字节原始帧 (Accel, Temp, Gyro; Big Endian)
+ */
+static void static_decode_frame(const uint8_t *p_buf, mpu6050_fifo_sample_t *p_out)
+{
+    p_out->accel.x = (int16_t)((p_buf[0] << 8) | p_buf[1]);
+    p_out->accel.y = (int16_t)((p_buf[2] << 8) | p_buf[3]);
+    p_out->accel.z = (int16_t)((p_buf[4] << 8) | p_buf[5]);
+    p_out->temp    = (int16_t)((p_buf[6] << 8) | p_buf[7]);
+    p_out->gyro.x  = (int16_t)((p_buf[8] << 8) | p_buf[9]);
+    p_out->gyro.y  = (int16_t)((p_buf[10] << 8) | p_buf[11]);
+    p_out->gyro.z  = (int16_t)((p_buf[12] << 8) | p_buf[13]);
+}
+
+/**
+ * @brief 数据就绪外部中断处理: 记录时间戳并发起异步读取
+ */
+static void static_drdy_isr(void *user_data)
+{
+    mpu6050_dev_t *p_dev = (mpu6050_dev_t *)user_data;
+    mpu6050_drdy_t *p_drdy = &p_dev->drdy;
+    uint8_t index;
+
+    if (!p_drdy->is_active) {
+        return;
+    }
+
+    /* 上一次传输尚未完成 (总线被占用或速率过高): 跳过本样本 */
+    if (p_drdy->is_busy) {
+        p_drdy->missed++;
+        return;
+    }
+
+    index = p_drdy->fill_index;
+    p_drdy->is_busy = true;
+    p_drdy->timestamp[index] = (p_dev->time_ops.get_tick != NULL) ? p_dev->time_ops.get_tick() : 0;
+
+    if (p_dev->i2c_ops.read_reg_async(p_dev->bus_ctx, p_dev->dev_addr, MPU6050_REG_ACCEL_XOUT_H,
+                                      p_drdy->buf[index], 14, static_drdy_done, p_dev) != DRV_OK) {
+        p_drdy->is_busy = false;
+        p_drdy->errors++;
+    }
+}
+
+/**
+ * @brief 异步读取完成: 切换双缓冲并发布样本
+ */
+static void static_drdy_done(void *user_data, driver_status_t status)
+{
+    mpu6050_dev_t *p_dev = (mpu6050_dev_t *)user_data;
+    mpu6050_drdy_t *p_drdy = &p_dev->drdy;
+    mpu6050_timed_sample_t sample;
+    uint8_t index = p_drdy->fill_index;
+
+    /* 采集已停止: 丢弃迟到的结果 */
+    if (!p_drdy->is_active) {
+        p_drdy->is_busy = false;
+        return;
+    }
+
+    if (status != DRV_OK) {
+        p_drdy->errors++;
+        p_drdy->is_busy = false;
+        return;
+    }
+
+    /* 刚填充的缓冲区成为发布缓冲区, 下一次传输写入另一个 */
+    p_drdy->fill_index = (uint8_t)(index ^ 1U);
+    sample.sequence = p_drdy->sequence;
+    p_drdy->sequence = sample.sequence + 1U;
+    p_drdy->is_busy = false;
+
+    if (p_drdy->cb != NULL) {
+        sample.timestamp = p_drdy->timestamp[index];
+        static_decode_frame(p_drdy->buf[index], &sample.data);
+        p_drdy->cb(p_drdy->user_data, &sample);
+    }
+}
+
+/**
+ * @brief 设置加速度计数字高通滤波器 (ACCEL_CONFIG 低3位, 运动检测使用)
+ */
+static driver_status_t static_set_accel_hpf(mpu6050_dev_t *p_dev, uint8_t hpf)
+{
+    uint8_t value = (uint8_t)((p_dev->shadow_cfg[MPU6050_SHADOW_ACCEL_CONFIG] & ~MPU6050_ACCEL_HPF_MASK) | hpf);
+
+    return static_update_shadow(p_dev, MPU6050_REG_ACCEL_CONFIG,
+                                &p_dev->shadow_cfg[MPU6050_SHADOW_ACCEL_CONFIG], &value, 1);
+}
+
+/**
+ * @brief 运动唤醒启动失败时恢复电源模式, 唤醒频率与高通滤波器 (尽力而为, 忽略写入错误)
+ */
+static void static_wom_restore(mpu6050_dev_t *p_dev, const uint8_t *p_pwr, uint8_t accel_cfg,
+                               mpu6050_wake_rate_t wake_rate)
+{
+    p_dev->wake_rate = wake_rate;
+    static_update_shadow(p_dev, MPU6050_REG_ACCEL_CONFIG,
+                         &p_dev->shadow_cfg[MPU6050_SHADOW_ACCEL_CONFIG], &accel_cfg, 1);
+    static_update_shadow(p_dev, MPU6050_REG_PWR_MGMT_1, p_dev->shadow_pwr, p_pwr, 2);
+}
+
+/**
+ * @brief 运动中断处理: 计数并通知应用层
+ */
+static void static_wom_isr(void *user_data)
+{
+    mpu6050_dev_t *p_dev = (mpu6050_dev_t *)user_data;
+    mpu6050_wom_t *p_wom = &p_dev->wom;
+
+    if (!p_wom->is_active) {
+        return;
+    }
+
+    p_wom->event_count++;
+    if (p_wom->cb != NULL) {
+        p_wom->cb(p_wom->user_data);
+    }
+}
+
+/**
+ * @brief 更新量程副本及对应的灵敏度 (量程已校验)
+ */
+static void static_apply_fs(mpu6050_dev_t *p_dev, mpu6050_gyro_fs_t gyro_fs, mpu6050_accel_fs_t accel_fs)
+{
+    p_dev->gyro_fs = gyro_fs;
+    p_dev->accel_fs = accel_fs;
+    p_dev->accel_sensitivity = s_accel_sensitivity[accel_fs];
+#if MPU6050_USE_FLOAT
+    p_dev->gyro_sensitivity = s_gyro_sensitivity[gyro_fs];
+#endif
+}
+
+static int32_t static_temp_to_cdeg(int16_t raw)
+{
+    return (((int32_t)raw * MPU6050_TEMP_CDEG_MUL + (1L << (MPU6050_TEMP_CDEG_SHIFT - 1))) >>
+            MPU6050_TEMP_CDEG_SHIFT) + MPU6050_TEMP_CDEG_OFFSET;
 }
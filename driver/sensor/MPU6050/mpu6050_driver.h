@@ -15,6 +15,22 @@
 #define MPU6050_ADDR_AD0_LOW     0x68  /**< AD0引脚接GND时的I2C地址 */
 #define MPU6050_ADDR_AD0_HIGH    0x69  /**< AD0引脚接VCC时的I2C地址 */
 
+#define MPU6050_FIFO_SIZE        1024  /**< 硬件FIFO容量 (bytes) */
+#define MPU6050_WOM_SETTLE_MS    5     /**< 运动唤醒启动时等待高通滤波器锁存的时间 (ms) */
+
+/* FIFO 采集传感器选择 (FIFO_EN 寄存器位, 可按位或组合) */
+#define MPU6050_FIFO_TEMP        0x80  /**< 温度 (2 bytes/帧) */
+#define MPU6050_FIFO_GYRO_X      0x40  /**< 陀螺仪X轴 (2 bytes/帧) */
+#define MPU6050_FIFO_GYRO_Y      0x20  /**< 陀螺仪Y轴 (2 bytes/帧) */
+#define MPU6050_FIFO_GYRO_Z      0x10  /**< 陀螺仪Z轴 (2 bytes/帧) */
+#define MPU6050_FIFO_ACCEL       0x08  /**< 加速度计3轴 (6 bytes/帧) */
+#define MPU6050_FIFO_GYRO        (MPU6050_FIFO_GYRO_X | MPU6050_FIFO_GYRO_Y | MPU6050_FIFO_GYRO_Z)
+
+/* 浮点支持: 置0时裁剪所有浮点字段与API, 只保留整数API, 避免无FPU的MCU链接软浮点库 */
+#ifndef MPU6050_USE_FLOAT
+#define MPU6050_USE_FLOAT        1
+#endif
+
 /* --- 2. 枚举定义 (Enumerations) --- */
 
 /**
@@ -50,6 +66,27 @@ typedef enum {
     MPU6050_DLPF_BW_5    = 6   /**< Accel: 5Hz,   Gyro: 5Hz */
 } mpu6050_dlpf_cfg_t;
 
+/**
+ * @brief 电源模式
+ */
+typedef enum {
+    MPU6050_POWER_NORMAL = 0,    /**< 加速度计 + 陀螺仪, 时钟源为陀螺仪 X 轴 PLL */
+    MPU6050_POWER_ACCEL_ONLY,    /**< 陀螺仪待机, 时钟源切换为内部 8MHz 振荡器 */
+    MPU6050_POWER_GYRO_ONLY,     /**< 加速度计待机 */
+    MPU6050_POWER_SLEEP,         /**< 休眠, 寄存器内容保持, I2C 仍可访问 */
+    MPU6050_POWER_CYCLE          /**< 低功耗循环: 按唤醒频率采样一次加速度计后休眠, 陀螺仪待机, 温度传感器关闭 */
+} mpu6050_power_mode_t;
+
+/**
+ * @brief 低功耗循环模式唤醒频率 (PWR_MGMT_2.LP_WAKE_CTRL)
+ */
+typedef enum {
+    MPU6050_WAKE_1_25HZ = 0,     /**< 1.25Hz, 约 10uA */
+    MPU6050_WAKE_5HZ    = 1,     /**< 5Hz, 约 20uA */
+    MPU6050_WAKE_20HZ   = 2,     /**< 20Hz, 约 70uA */
+    MPU6050_WAKE_40HZ   = 3      /**< 40Hz, 约 140uA */
+} mpu6050_wake_rate_t;
+
 /* --- 3. 配置结构体 (Configuration Struct) --- */
 
 /**
@@ -62,28 +99,19 @@ typedef struct {
     uint8_t            sample_rate_div; /**< 采样率分频 (Sample Rate = Gyroscope Output Rate / (1 + SMPLRT_DIV)) */
 } mpu6050_config_t;
 
-/* --- 4. 设备句柄 (Device Handle) --- */
-
 /**
- * @brief MPU6050 设备对象
- * @note  内存由调用者管理
+ * @brief 运动唤醒配置
  */
 typedef struct {
-    /* 依赖接口 (必须注入) */
-    driver_i2c_ops_t  i2c_ops;     /**< I2C读写接口 */
-    driver_time_ops_t time_ops;    /**< 延时接口 */
-    
-    /* 运行状态 */
-    void     *bus_ctx;             /**< 总线上下文 (如 I2C_HandleTypeDef*) */
-    uint8_t   dev_addr;            /**< 设备I2C地址 */
-    bool      is_initialized;      /**< 初始化标志 */
-    
-    /* 当前配置副本 (用于数据转换) */
-    float     gyro_sensitivity;    /**< 陀螺仪灵敏度 (LSB/dps) */
-    uint16_t  accel_sensitivity;   /**< 加速度计灵敏度 (LSB/g) */
-} mpu6050_dev_t;
+    uint16_t            threshold_mg; /**< 运动阈值 (mg, 分辨率 2mg, 2 ~ 510) */
+    uint8_t             duration_ms;  /**< 超过阈值的持续时间 (ms, 1 LSB = 1 次加速度计采样) */
+    mpu6050_wake_rate_t wake_rate;    /**< 低功耗循环唤醒频率, 决定检测延迟与电流 */
+} mpu6050_motion_config_t;
 
-/* --- 5. 数据结构 (Data Structs) --- */
+/** 默认配置: 阈值 40mg, 持续 1 次采样, 5Hz 唤醒 (约 20uA) */
+#define MPU6050_MOTION_DEFAULT_CONFIG { 40, 1, MPU6050_WAKE_5HZ }
+
+/* --- 4. 数据结构 (Data Structs) --- */
 
 /**
  * @brief 3轴原始数据 (int16_t)
@@ -94,6 +122,7 @@ typedef struct {
     int16_t z;
 } mpu6050_raw_data_t;
 
+#if MPU6050_USE_FLOAT
 /**
  * @brief 3轴浮点数据 (物理量)
  */
@@ -102,6 +131,135 @@ typedef struct {
     float y;
     float z;
 } mpu6050_float_data_t;
+#endif
+
+/**
+ * @brief 3轴整数数据 (物理量, 单位由API决定: mg 或 mdps)
+ */
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+} mpu6050_int_data_t;
+
+/**
+ * @brief FIFO 单帧样本 (原始数据)
+ * @note  未写入FIFO的传感器对应字段为0
+ */
+typedef struct {
+    mpu6050_raw_data_t accel;   /**< 加速度计原始值 */
+    int16_t            temp;    /**< 温度原始值 */
+    mpu6050_raw_data_t gyro;    /**< 陀螺仪原始值 */
+} mpu6050_fifo_sample_t;
+
+/**
+ * @brief 带时间戳的样本 (数据就绪中断采集)
+ */
+typedef struct {
+    uint32_t              timestamp;  /**< 数据就绪中断时刻 (get_tick, ms; 未提供 get_tick 时为0) */
+    uint32_t              sequence;   /**< 样本序号 (每发布一个样本加1, 可结合采样周期重建精确时间) */
+    mpu6050_fifo_sample_t data;       /**< 原始数据 (Accel, Temp, Gyro) */
+} mpu6050_timed_sample_t;
+
+/**
+ * @brief 样本发布回调
+ * @note  在I2C传输完成回调 (通常为中断) 上下文中执行, 应尽快返回.
+ *        p_sample 仅在回调期间有效
+ */
+typedef void (*mpu6050_sample_callback_t)(void *user_data, const mpu6050_timed_sample_t *p_sample);
+
+/**
+ * @brief 数据就绪中断采集状态 (驱动内部使用)
+ * @note  双缓冲: 一个缓冲区接收进行中的传输, 另一个保存最近发布的样本
+ */
+typedef struct {
+    driver_exti_ops_t          exti_ops;      /**< 外部中断接口 */
+    void                      *exti_ctx;      /**< 外部中断句柄 */
+    uint8_t                    pin_num;       /**< INT 引脚连接的中断线 */
+    mpu6050_sample_callback_t  cb;            /**< 样本发布回调 (可为NULL) */
+    void                      *user_data;     /**< 回调用户数据 */
+    uint8_t                    buf[2][14];    /**< 原始数据双缓冲 */
+    uint32_t                   timestamp[2];  /**< 各缓冲区对应的中断时刻 */
+    volatile uint8_t           fill_index;    /**< 正在接收传输的缓冲区 */
+    volatile bool              is_busy;       /**< 传输进行中 */
+    volatile uint32_t          sequence;      /**< 已发布的样本数 */
+    volatile uint32_t          missed;        /**< 因上一次传输未完成而跳过的中断数 */
+    volatile uint32_t          errors;        /**< 传输失败次数 */
+    bool                       is_active;     /**< 中断采集已启动 */
+} mpu6050_drdy_t;
+
+/**
+ * @brief 运动唤醒回调
+ * @note  在外部中断上下文中执行, 不应访问 I2C; 通常只置标志, 由主循环处理
+ */
+typedef void (*mpu6050_motion_callback_t)(void *user_data);
+
+/**
+ * @brief 运动唤醒状态 (驱动内部使用)
+ */
+typedef struct {
+    driver_exti_ops_t          exti_ops;      /**< 外部中断接口 */
+    void                      *exti_ctx;      /**< 外部中断句柄 */
+    uint8_t                    pin_num;       /**< INT 引脚连接的中断线 */
+    mpu6050_motion_callback_t  cb;            /**< 运动事件回调 (可为NULL) */
+    void                      *user_data;     /**< 回调用户数据 */
+    volatile uint32_t          event_count;   /**< 已发生的运动中断次数 */
+    bool                       is_active;     /**< 运动唤醒已启动 */
+} mpu6050_wom_t;
+
+/**
+ * @brief 电源模式功耗估算 (典型值, 来自数据手册)
+ */
+typedef struct {
+    uint32_t current_ua;     /**< 平均电流 (uA, VDD = 3.3V 典型值) */
+    uint16_t duty_permille;  /**< 加速度计/陀螺仪前端工作时间占比 (千分比) */
+} mpu6050_power_estimate_t;
+
+/* --- 5. 设备句柄 (Device Handle) --- */
+
+/**
+ * @brief MPU6050 设备对象
+ * @note  内存由调用者管理
+ */
+typedef struct {
+    /* 依赖接口 (必须注入) */
+    driver_i2c_ops_t  i2c_ops;     /**< I2C读写接口 */
+    driver_time_ops_t time_ops;    /**< 延时接口 */
+    
+    /* 运行状态 */
+    void     *bus_ctx;             /**< 总线上下文 (如 I2C_HandleTypeDef*) */
+    uint8_t   dev_addr;            /**< 设备I2C地址 */
+    bool      is_initialized;      /**< 初始化标志 */
+    
+    /* 寄存器影子: 与芯片寄存器内容一致, 设置函数据此跳过未变化的写入 */
+    uint8_t   shadow_cfg[4];       /**< SMPLRT_DIV, CONFIG, GYRO_CONFIG, ACCEL_CONFIG (0x19 ~ 0x1C) */
+    uint8_t   shadow_pwr[2];       /**< PWR_MGMT_1, PWR_MGMT_2 (0x6B ~ 0x6C) */
+
+    /* 当前配置副本 (用于数据转换, 与影子寄存器同时更新) */
+    mpu6050_gyro_fs_t  gyro_fs;    /**< 陀螺仪量程 */
+    mpu6050_accel_fs_t accel_fs;   /**< 加速度计量程 */
+    mpu6050_wake_rate_t wake_rate; /**< 低功耗循环唤醒频率 */
+#if MPU6050_USE_FLOAT
+    float     gyro_sensitivity;    /**< 陀螺仪灵敏度 (LSB/dps) */
+#endif
+    uint16_t  accel_sensitivity;   /**< 加速度计灵敏度 (LSB/g) */
+
+    /* FIFO 状态 */
+    uint8_t   fifo_sensors;        /**< FIFO中的传感器 (MPU6050_FIFO_xxx), 0表示未使能 */
+    uint8_t   fifo_frame_size;     /**< 每帧字节数 */
+    uint32_t  fifo_overflow_count; /**< FIFO溢出后复位重同步的次数 */
+
+    /* 数据就绪中断采集状态 */
+    mpu6050_drdy_t drdy;
+
+    /* 运动唤醒状态 (与数据就绪中断共用 INT 引脚, 二者互斥) */
+    mpu6050_wom_t wom;
+} mpu6050_dev_t;
+
+/**
+ * @brief 按量程索引的陀螺仪灵敏度 x10 (LSB/dps), 供可选模块做整数换算
+ */
+extern const uint16_t g_mpu6050_gyro_lsb_x10[4];
 
 /* --- 6. API 函数声明 (Function Prototypes) --- */
 
@@ -129,6 +287,7 @@ driver_status_t mpu6050_init(mpu6050_dev_t *p_dev,
  */
 driver_status_t mpu6050_reset(mpu6050_dev_t *p_dev);
 
+#if MPU6050_USE_FLOAT
 /**
  * @brief 读取加速度计数据
  * @param p_dev 设备句柄指针
@@ -168,5 +327,352 @@ driver_status_t mpu6050_read_all(mpu6050_dev_t *p_dev,
                                  mpu6050_float_data_t *p_accel, 
                                  mpu6050_float_data_t *p_gyro, 
                                  float *p_temp);
+#endif /* MPU6050_USE_FLOAT */
+
+/**
+ * @brief 读取加速度计数据 (整数)
+ * @note  raw * mul >> shift, 比例系数按量程编译期查表, 不使用浮点运算
+ * @param p_dev 设备句柄指针
+ * @param p_raw 原始数据输出 (可选, NULL则不输出)
+ * @param p_val 物理量数据输出 (单位: mg, 可选)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_read_accel_mg(mpu6050_dev_t *p_dev, mpu6050_raw_data_t *p_raw, mpu6050_int_data_t *p_val);
+
+/**
+ * @brief 读取陀螺仪数据 (整数)
+ * @param p_dev 设备句柄指针
+ * @param p_raw 原始数据输出 (可选, NULL则不输出)
+ * @param p_val 物理量数据输出 (单位: mdps, 可选)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_read_gyro_mdps(mpu6050_dev_t *p_dev, mpu6050_raw_data_t *p_raw, mpu6050_int_data_t *p_val);
+
+/**
+ * @brief 读取温度 (整数)
+ * @param p_dev 设备句柄指针
+ * @param p_temp 温度输出 (单位: 0.01 摄氏度)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_read_temp_cdeg(mpu6050_dev_t *p_dev, int32_t *p_temp);
+
+/**
+ * @brief 读取所有传感器数据 (整数, 一次I2C读取)
+ * @param p_dev 设备句柄指针
+ * @param p_accel 加速度输出 (mg, 可为NULL)
+ * @param p_gyro 陀螺仪输出 (mdps, 可为NULL)
+ * @param p_temp 温度输出 (0.01 C, 可为NULL)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_read_all_int(mpu6050_dev_t *p_dev,
+                                     mpu6050_int_data_t *p_accel,
+                                     mpu6050_int_data_t *p_gyro,
+                                     int32_t *p_temp);
+
+/**
+ * @brief 加速度原始值转换为 mg (用于 FIFO 样本)
+ * @param p_dev 设备句柄指针 (使用其当前量程)
+ * @param p_raw 原始数据
+ * @param p_val 输出 (mg)
+ */
+void mpu6050_accel_to_mg(const mpu6050_dev_t *p_dev, const mpu6050_raw_data_t *p_raw, mpu6050_int_data_t *p_val);
+
+/**
+ * @brief 角速度原始值转换为 mdps (用于 FIFO 样本)
+ * @param p_dev 设备句柄指针 (使用其当前量程)
+ * @param p_raw 原始数据
+ * @param p_val 输出 (mdps)
+ */
+void mpu6050_gyro_to_mdps(const mpu6050_dev_t *p_dev, const mpu6050_raw_data_t *p_raw, mpu6050_int_data_t *p_val);
+
+/**
+ * @brief 运行时重新配置量程、DLPF 与采样率分频 (不复位芯片)
+ * @param p_dev 设备句柄指针
+ * @param p_cfg 新配置
+ * @return driver_status_t
+ * @note  与影子寄存器比较, 只写入有变化的寄存器 (0x19 ~ 0x1C 中变化的连续区间一次突发写入);
+ *        写入成功后才同时更新量程与灵敏度, 写入失败时保持原值.
+ *        量程切换只需一次 4 字节的 I2C 传输 (地址 + 寄存器 + 2 数据), 最多影响切换期间的1个样本;
+ *        FIFO 中切换前的样本仍为旧量程, 如需区分请在切换前读空 FIFO
+ */
+driver_status_t mpu6050_configure(mpu6050_dev_t *p_dev, const mpu6050_config_t *p_cfg);
+
+/**
+ * @brief 读取当前配置 (来自影子寄存器, 不访问总线)
+ * @param p_dev 设备句柄指针
+ * @param p_cfg 输出配置
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_get_config(const mpu6050_dev_t *p_dev, mpu6050_config_t *p_cfg);
+
+/**
+ * @brief 同时设置陀螺仪与加速度计量程 (GYRO_CONFIG/ACCEL_CONFIG 一次突发写入)
+ * @param p_dev 设备句柄指针
+ * @param gyro_fs 陀螺仪量程
+ * @param accel_fs 加速度计量程
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_set_fs(mpu6050_dev_t *p_dev, mpu6050_gyro_fs_t gyro_fs, mpu6050_accel_fs_t accel_fs);
+
+/**
+ * @brief 设置陀螺仪量程
+ * @param p_dev 设备句柄指针
+ * @param gyro_fs 陀螺仪量程
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_set_gyro_fs(mpu6050_dev_t *p_dev, mpu6050_gyro_fs_t gyro_fs);
+
+/**
+ * @brief 设置加速度计量程
+ * @param p_dev 设备句柄指针
+ * @param accel_fs 加速度计量程
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_set_accel_fs(mpu6050_dev_t *p_dev, mpu6050_accel_fs_t accel_fs);
+
+/**
+ * @brief 设置数字低通滤波器
+ * @param p_dev 设备句柄指针
+ * @param dlpf_cfg DLPF 配置 (MPU6050_DLPF_BW_260 时陀螺仪输出率变为 8kHz)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_set_dlpf(mpu6050_dev_t *p_dev, mpu6050_dlpf_cfg_t dlpf_cfg);
+
+/**
+ * @brief 设置采样率分频
+ * @param p_dev 设备句柄指针
+ * @param sample_rate_div 分频值 (Sample Rate = Gyroscope Output Rate / (1 + div))
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_set_sample_rate_div(mpu6050_dev_t *p_dev, uint8_t sample_rate_div);
+
+/**
+ * @brief 设置电源模式
+ * @param p_dev 设备句柄指针
+ * @param mode 电源模式
+ * @return driver_status_t
+ * @note  PWR_MGMT_1/PWR_MGMT_2 有变化时一次突发写入;
+ *        陀螺仪从待机或休眠恢复后约 30ms 才输出稳定数据.
+ *        MPU6050_POWER_CYCLE 下只有加速度计数据寄存器按唤醒频率更新, 不使用 FIFO
+ */
+driver_status_t mpu6050_set_power_mode(mpu6050_dev_t *p_dev, mpu6050_power_mode_t mode);
+
+/**
+ * @brief 设置低功耗循环模式的唤醒频率
+ * @param p_dev 设备句柄指针
+ * @param rate 唤醒频率
+ * @return driver_status_t
+ * @note  当前处于 MPU6050_POWER_CYCLE 时立即生效, 否则在下次进入循环模式时生效
+ */
+driver_status_t mpu6050_set_wake_rate(mpu6050_dev_t *p_dev, mpu6050_wake_rate_t rate);
+
+/**
+ * @brief 估算电源模式的平均电流 (不访问设备)
+ * @param mode 电源模式
+ * @param rate 唤醒频率 (仅 MPU6050_POWER_CYCLE 使用)
+ * @param p_est 输出估算值
+ * @return driver_status_t
+ * @note  数据手册典型值: 正常 3.9mA, 仅陀螺仪 3.6mA, 仅加速度计 500uA,
+ *        循环 10/20/70/140uA (1.25/5/20/40Hz), 休眠 5uA; 不含 I2C 传输与上拉电阻电流.
+ *        循环模式的占空比由 (I_cycle - I_sleep) / (I_accel - I_sleep) 反推
+ */
+driver_status_t mpu6050_power_estimate(mpu6050_power_mode_t mode,
+                                       mpu6050_wake_rate_t rate,
+                                       mpu6050_power_estimate_t *p_est);
+
+/**
+ * @brief 获取当前采样周期
+ * @note  陀螺仪输出率在 DLPF 关闭 (MPU6050_DLPF_BW_260) 时为 8kHz, 否则为 1kHz;
+ *        采样周期 = (1 + sample_rate_div) / 输出率, 以整数微秒表示无舍入误差;
+ *        低功耗循环模式下为唤醒周期
+ * @param p_dev 设备句柄指针
+ * @return 采样周期 (us), 未初始化时返回0
+ */
+uint32_t mpu6050_get_sample_period_us(const mpu6050_dev_t *p_dev);
+
+/**
+ * @brief 读取陀螺仪硬件偏置寄存器 (XG/YG/ZG_OFFS_USR)
+ * @param p_dev 设备句柄指针
+ * @param p_offset 输出偏置, 单位为 ±1000dps 量程的 LSB (32.8 LSB/dps)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_get_gyro_offset(mpu6050_dev_t *p_dev, mpu6050_raw_data_t *p_offset);
+
+/**
+ * @brief 写入陀螺仪硬件偏置寄存器, 芯片输出即为扣除偏置后的数据
+ * @param p_dev 设备句柄指针
+ * @param p_offset 偏置 (±1000dps 量程的 LSB), 与原始数据相加
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_set_gyro_offset(mpu6050_dev_t *p_dev, const mpu6050_raw_data_t *p_offset);
+
+/**
+ * @brief 读取加速度计硬件偏置寄存器 (XA/YA/ZA_OFFS, 出厂已写入校准值)
+ * @param p_dev 设备句柄指针
+ * @param p_offset 输出偏置, 单位为 ±16g 量程的 LSB (2048 LSB/g); bit0 为保留位
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_get_accel_offset(mpu6050_dev_t *p_dev, mpu6050_raw_data_t *p_offset);
+
+/**
+ * @brief 写入加速度计硬件偏置寄存器
+ * @param p_dev 设备句柄指针
+ * @param p_offset 偏置 (±16g 量程的 LSB), 与原始数据相加
+ * @return driver_status_t
+ * @note  每个寄存器的 bit0 (温度补偿相关保留位) 保持芯片原值, p_offset 的 bit0 被忽略
+ */
+driver_status_t mpu6050_set_accel_offset(mpu6050_dev_t *p_dev, const mpu6050_raw_data_t *p_offset);
+
+/**
+ * @brief 使能FIFO并选择写入FIFO的传感器
+ * @note  每个采样周期传感器按寄存器顺序 (Accel, Temp, Gyro X/Y/Z) 写入一帧.
+ *        使能时FIFO被清空.
+ * @param p_dev 设备句柄指针
+ * @param sensors 传感器选择 (MPU6050_FIFO_xxx 按位或, 不能为0)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fifo_enable(mpu6050_dev_t *p_dev, uint8_t sensors);
+
+/**
+ * @brief 禁用FIFO
+ * @param p_dev 设备句柄指针
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fifo_disable(mpu6050_dev_t *p_dev);
+
+/**
+ * @brief 清空FIFO (丢弃所有未读帧)
+ * @param p_dev 设备句柄指针
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fifo_reset(mpu6050_dev_t *p_dev);
+
+/**
+ * @brief 获取FIFO中完整帧的数量
+ * @param p_dev 设备句柄指针
+ * @param p_count 帧数输出
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fifo_get_count(mpu6050_dev_t *p_dev, uint16_t *p_count);
+
+/**
+ * @brief 从FIFO批量读取样本
+ * @note  读取FIFO_COUNT后用一次I2C传输读出所有完整帧 (最多 max_count 帧),
+ *        原始字节直接读入 p_samples 并原地解码, 无需额外缓冲区.
+ *        FIFO写满或溢出时帧边界已不可信: 清空FIFO重新对齐并返回 DRV_ERR_NO_MEM,
+ *        调用者据此得知发生了丢帧.
+ * @param p_dev 设备句柄指针
+ * @param p_samples 样本输出数组
+ * @param max_count 数组容量 (帧)
+ * @param p_count 实际读取的帧数输出
+ * @return driver_status_t
+ * @retval DRV_ERR_NO_MEM FIFO已溢出, 已复位重同步, 本次未读取数据
+ */
+driver_status_t mpu6050_fifo_read(mpu6050_dev_t *p_dev,
+                                  mpu6050_fifo_sample_t *p_samples,
+                                  uint16_t max_count,
+                                  uint16_t *p_count);
+
+/**
+ * @brief 从FIFO批量读取原始帧 (不解码)
+ * @note  与 mpu6050_fifo_read 相同的读取与溢出处理, 输出保持FIFO中的大端字节序,
+ *        供批量转换 (mpu6050_convert) 或原样记录/上传使用
+ * @param p_dev 设备句柄指针
+ * @param p_frames 原始帧输出缓冲区 (至少 max_count * fifo_frame_size 字节)
+ * @param max_count 缓冲区容量 (帧)
+ * @param p_count 实际读取的帧数输出
+ * @return driver_status_t
+ * @retval DRV_ERR_NO_MEM FIFO已溢出, 已复位重同步, 本次未读取数据
+ */
+driver_status_t mpu6050_fifo_read_raw(mpu6050_dev_t *p_dev,
+                                      uint8_t *p_frames,
+                                      uint16_t max_count,
+                                      uint16_t *p_count);
+
+/**
+ * @brief 读取已知数量的完整帧 (不查询 FIFO 计数与溢出标志)
+ * @note  用于先通过 mpu6050_fifo_get_count 查询、再按调度批量读取的场景 (如多设备组),
+ *        省去一次计数读取; 调用者需保证 FIFO 中至少有 count 帧, 并自行处理溢出
+ * @param p_dev 设备句柄指针
+ * @param p_samples 样本输出数组 (至少 count 个)
+ * @param count 读取的帧数
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fifo_read_frames(mpu6050_dev_t *p_dev,
+                                         mpu6050_fifo_sample_t *p_samples,
+                                         uint16_t count);
+
+/**
+ * @brief 启动数据就绪中断采集
+ * @note  配置 INT 引脚为高电平有效的 50us 脉冲并使能 DATA_RDY 中断, 通过 p_exti_ops->enable 注册处理函数.
+ *        每次数据就绪时在中断中记录时间戳并发起 read_reg_async 读取14字节数据寄存器,
+ *        传输完成后解码并发布样本: 样本就绪到可用的延迟为一次传输时间, 应用层无需轮询.
+ *        需要 I2C 接口提供 read_reg_async.
+ * @param p_dev 设备句柄指针
+ * @param p_exti_ops 外部中断接口指针
+ * @param exti_ctx 外部中断句柄
+ * @param pin_num MPU6050 INT 引脚连接的中断线 (0-15)
+ * @param cb 样本发布回调 (可为NULL, 此时通过 mpu6050_drdy_get_latest 获取)
+ * @param user_data 回调用户数据
+ * @return driver_status_t
+ * @retval DRV_ERR_BUSY 采集或运动唤醒已在运行, 或上一次采集停止时发起的异步读取尚未完成
+ */
+driver_status_t mpu6050_drdy_start(mpu6050_dev_t *p_dev,
+                                   const driver_exti_ops_t *p_exti_ops,
+                                   void *exti_ctx,
+                                   uint8_t pin_num,
+                                   mpu6050_sample_callback_t cb,
+                                   void *user_data);
+
+/**
+ * @brief 停止数据就绪中断采集
+ * @note  不等待正在进行的异步读取; 其完成回调只释放传输, 不再发布样本
+ * @param p_dev 设备句柄指针
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_drdy_stop(mpu6050_dev_t *p_dev);
+
+/**
+ * @brief 获取最近发布的样本
+ * @note  可在任务上下文调用; 复制期间若有新样本发布则自动重试, 保证结果一致
+ * @param p_dev 设备句柄指针
+ * @param p_sample 样本输出
+ * @return driver_status_t
+ * @retval DRV_ERR_BUSY 尚未发布任何样本
+ */
+driver_status_t mpu6050_drdy_get_latest(mpu6050_dev_t *p_dev, mpu6050_timed_sample_t *p_sample);
+
+/**
+ * @brief 启动运动唤醒 (Wake-on-Motion)
+ * @note  加速度计高通滤波器锁存当前姿态 (ACCEL_HPF = Hold), 之后任一轴相对锁存值的变化
+ *        超过阈值并持续 duration_ms 即产生 MOT_INT, INT 引脚输出 50us 高电平脉冲;
+ *        芯片进入 MPU6050_POWER_CYCLE, 主机 MCU 可在 STOP 模式下等待该外部中断唤醒.
+ *        启动期间阻塞约 MPU6050_WOM_SETTLE_MS 等待加速度计稳定; 需要传感器处于静止.
+ * @param p_dev 设备句柄指针
+ * @param p_config 运动唤醒配置 (NULL 使用默认配置)
+ * @param p_exti_ops 外部中断接口指针
+ * @param exti_ctx 外部中断句柄
+ * @param pin_num MPU6050 INT 引脚连接的中断线 (0-15)
+ * @param cb 运动事件回调 (可为NULL, 此时查询 wom.event_count)
+ * @param user_data 回调用户数据
+ * @return driver_status_t
+ * @retval DRV_ERR_BUSY 数据就绪中断采集或运动唤醒已在运行
+ * @retval DRV_ERR_IO 通信失败; 电源模式与加速度计高通滤波器恢复为调用前的设置
+ */
+driver_status_t mpu6050_wom_start(mpu6050_dev_t *p_dev,
+                                  const mpu6050_motion_config_t *p_config,
+                                  const driver_exti_ops_t *p_exti_ops,
+                                  void *exti_ctx,
+                                  uint8_t pin_num,
+                                  mpu6050_motion_callback_t cb,
+                                  void *user_data);
+
+/**
+ * @brief 停止运动唤醒, 关闭高通滤波器并恢复 MPU6050_POWER_NORMAL
+ * @param p_dev 设备句柄指针
+ * @return driver_status_t
+ * @note  陀螺仪恢复后约 30ms 才输出稳定数据
+ */
+driver_status_t mpu6050_wom_stop(mpu6050_dev_t *p_dev);
 
 #endif /* _MPU6050_DRIVER_H_ */
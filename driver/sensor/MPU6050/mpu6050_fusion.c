@@ -0,0 +1,544 @@
+/**
+ * @file mpu6050_fusion.c
+ * @brief MPU6050 姿态融合实现
+ */
+
+#include "mpu6050_fusion.h"
+#include <string.h>
+#if MPU6050_USE_FLOAT
+#include <math.h>
+#endif
+
+/* --- 1. 私有宏定义 (Private Macros) --- */
+
+/*
+ * 定点格式:
+ * - 四元数 Q30, 加速度/重力方向单位向量 Q14 (叉积 Q28 不会溢出)
+ * - 半角增量 delta = omega * dt / 2 (rad, Q30)
+ * 64 位乘积右移时加半个 LSB 舍入, 避免截断误差累积成固定方向的漂移.
+ */
+#define FUSION_Q30_MUL(a, b)      ((int64_t)(a) * (b))
+#define FUSION_ROUND_SHIFT(v, n)  ((int32_t)(((v) + ((int64_t)1 << ((n) - 1))) >> (n)))
+
+/*
+ * 陀螺仪半角系数: gyro_k = (pi / 180) / (lsb_x10 / 10) * (dt_us * 1e-6) / 2 * 2^46
+ *                       = FUSION_GYRO_K_NUM * dt_us / lsb_x10
+ * FUSION_GYRO_K_NUM = round(10 * pi * 2^45 / 180e6)
+ */
+#define FUSION_GYRO_K_NUM         6140706LL
+
+/* 欧拉角: 180 度 (0.01 度单位) */
+#define FUSION_CDEG_180           18000
+#define FUSION_CDEG_90            9000
+
+#if MPU6050_USE_FLOAT
+#define FUSION_DEG_PER_RAD        57.29577951f
+#define FUSION_RAD_PER_DEG        0.01745329252f
+#endif
+
+/* --- 2. 私有函数声明 (Private Functions) --- */
+
+static void static_update_q(mpu6050_fusion_q_t *p_fusion, const mpu6050_fifo_sample_t *p_sample);
+static uint32_t static_isqrt(uint32_t value);
+static int32_t static_atan2_cdeg(int32_t y, int32_t x);
+#if MPU6050_USE_FLOAT
+static void static_update_mahony(mpu6050_fusion_t *p_fusion, const mpu6050_fifo_sample_t *p_sample);
+static void static_update_madgwick(mpu6050_fusion_t *p_fusion, const mpu6050_fifo_sample_t *p_sample);
+#endif
+
+/* --- 3. 公共函数实现 (Public Functions) --- */
+
+driver_status_t mpu6050_fusion_q_init(mpu6050_fusion_q_t *p_fusion,
+                                      const mpu6050_dev_t *p_dev,
+                                      uint32_t kp_q16,
+                                      uint32_t ki_q16)
+{
+    uint32_t dt_us;
+    int64_t kp_half_dt;
+    int64_t ki_dt;
+    int64_t gyro_k;
+
+    if (p_fusion == NULL || p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    dt_us = mpu6050_get_sample_period_us(p_dev);
+
+    /* kp * dt / 2 (Q30) = kp_q16 * dt_us * 2^13 / 1e6 */
+    kp_half_dt = ((int64_t)kp_q16 * dt_us * 8192) / 1000000;
+    ki_dt = ((int64_t)ki_q16 * dt_us * 16384) / 1000000;
+
+    /* Q46 半角系数与 dt 成正比: ±2000dps 时 dt 超过约 57ms 即超出 int32 */
+    gyro_k = (FUSION_GYRO_K_NUM * dt_us) / g_mpu6050_gyro_lsb_x10[p_dev->gyro_fs];
+
+    if (kp_half_dt > INT32_MAX || ki_dt > INT32_MAX || gyro_k > INT32_MAX) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_fusion->gyro_k = (int32_t)gyro_k;
+    p_fusion->kp_half_dt = (int32_t)kp_half_dt;
+    p_fusion->ki_dt = (int32_t)ki_dt;
+    p_fusion->half_dt = (int32_t)(((int64_t)dt_us << 29) / 1000000);
+
+    mpu6050_fusion_q_reset(p_fusion);
+    p_fusion->is_initialized = true;
+
+    return DRV_OK;
+}
+
+void mpu6050_fusion_q_reset(mpu6050_fusion_q_t *p_fusion)
+{
+    if (p_fusion == NULL) return;
+
+    p_fusion->q.w = MPU6050_FUSION_Q_ONE;
+    p_fusion->q.x = 0;
+    p_fusion->q.y = 0;
+    p_fusion->q.z = 0;
+    memset(p_fusion->integral, 0, sizeof(p_fusion->integral));
+}
+
+driver_status_t mpu6050_fusion_q_update(mpu6050_fusion_q_t *p_fusion,
+                                        const mpu6050_fifo_sample_t *p_sample)
+{
+    if (p_fusion == NULL || !p_fusion->is_initialized || p_sample == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    static_update_q(p_fusion, p_sample);
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fusion_q_update_batch(mpu6050_fusion_q_t *p_fusion,
+                                              const mpu6050_fifo_sample_t *p_samples,
+                                              uint16_t count)
+{
+    uint16_t i;
+
+    if (p_fusion == NULL || !p_fusion->is_initialized || (p_samples == NULL && count > 0)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    for (i = 0; i < count; i++) {
+        static_update_q(p_fusion, &p_samples[i]);
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fusion_q_get_quat(const mpu6050_fusion_q_t *p_fusion,
+                                          mpu6050_quat_q30_t *p_quat)
+{
+    if (p_fusion == NULL || !p_fusion->is_initialized || p_quat == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    *p_quat = p_fusion->q;
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fusion_q_get_euler(const mpu6050_fusion_q_t *p_fusion,
+                                           mpu6050_euler_cdeg_t *p_euler)
+{
+    int32_t q0, q1, q2, q3;
+    int32_t sin_pitch;
+    int32_t cos_pitch;
+
+    if (p_fusion == NULL || !p_fusion->is_initialized || p_euler == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    q0 = p_fusion->q.w;
+    q1 = p_fusion->q.x;
+    q2 = p_fusion->q.y;
+    q3 = p_fusion->q.z;
+
+    /* 各项为 Q60 乘积, 右移 44 得到 2 * (...) 的 Q15 值 */
+    p_euler->roll = static_atan2_cdeg(
+        FUSION_ROUND_SHIFT(FUSION_Q30_MUL(q0, q1) + FUSION_Q30_MUL(q2, q3), 44),
+        FUSION_ROUND_SHIFT(((int64_t)1 << 59) - FUSION_Q30_MUL(q1, q1) - FUSION_Q30_MUL(q2, q2), 44));
+
+    p_euler->yaw = static_atan2_cdeg(
+        FUSION_ROUND_SHIFT(FUSION_Q30_MUL(q0, q3) + FUSION_Q30_MUL(q1, q2), 44),
+        FUSION_ROUND_SHIFT(((int64_t)1 << 59) - FUSION_Q30_MUL(q2, q2) - FUSION_Q30_MUL(q3, q3), 44));
+
+    /* pitch = asin(s) = atan2(s, sqrt(1 - s^2)) */
+    sin_pitch = FUSION_ROUND_SHIFT(FUSION_Q30_MUL(q0, q2) - FUSION_Q30_MUL(q3, q1), 44);
+    if (sin_pitch > 32768) sin_pitch = 32768;
+    if (sin_pitch < -32768) sin_pitch = -32768;
+    cos_pitch = (int32_t)static_isqrt((uint32_t)((1L << 30) - sin_pitch * sin_pitch));
+    p_euler->pitch = static_atan2_cdeg(sin_pitch, cos_pitch);
+
+    return DRV_OK;
+}
+
+#if MPU6050_USE_FLOAT
+driver_status_t mpu6050_fusion_init(mpu6050_fusion_t *p_fusion,
+                                    const mpu6050_dev_t *p_dev,
+                                    const mpu6050_fusion_config_t *p_config)
+{
+    static const mpu6050_fusion_config_t default_config = MPU6050_FUSION_DEFAULT_CONFIG;
+
+    if (p_fusion == NULL || p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_config == NULL) {
+        p_config = &default_config;
+    }
+
+    if (p_config->algo > MPU6050_FUSION_MADGWICK) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_fusion->config = *p_config;
+    p_fusion->gyro_scale = FUSION_RAD_PER_DEG / p_dev->gyro_sensitivity;
+    p_fusion->dt = (float)mpu6050_get_sample_period_us(p_dev) * 1e-6f;
+
+    mpu6050_fusion_reset(p_fusion);
+    p_fusion->is_initialized = true;
+
+    return DRV_OK;
+}
+
+void mpu6050_fusion_reset(mpu6050_fusion_t *p_fusion)
+{
+    if (p_fusion == NULL) return;
+
+    p_fusion->q.w = 1.0f;
+    p_fusion->q.x = 0.0f;
+    p_fusion->q.y = 0.0f;
+    p_fusion->q.z = 0.0f;
+    memset(p_fusion->integral, 0, sizeof(p_fusion->integral));
+}
+
+driver_status_t mpu6050_fusion_update(mpu6050_fusion_t *p_fusion,
+                                      const mpu6050_fifo_sample_t *p_sample)
+{
+    return mpu6050_fusion_update_batch(p_fusion, p_sample, 1);
+}
+
+driver_status_t mpu6050_fusion_update_batch(mpu6050_fusion_t *p_fusion,
+                                            const mpu6050_fifo_sample_t *p_samples,
+                                            uint16_t count)
+{
+    uint16_t i;
+
+    if (p_fusion == NULL || !p_fusion->is_initialized || (p_samples == NULL && count > 0)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    /* 算法在循环外选定, 循环体内无分支切换 */
+    if (p_fusion->config.algo == MPU6050_FUSION_MADGWICK) {
+        for (i = 0; i < count; i++) {
+            static_update_madgwick(p_fusion, &p_samples[i]);
+        }
+    } else {
+        for (i = 0; i < count; i++) {
+            static_update_mahony(p_fusion, &p_samples[i]);
+        }
+    }
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fusion_get_quat(const mpu6050_fusion_t *p_fusion,
+                                        mpu6050_quat_t *p_quat)
+{
+    if (p_fusion == NULL || !p_fusion->is_initialized || p_quat == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    *p_quat = p_fusion->q;
+
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_fusion_get_euler(const mpu6050_fusion_t *p_fusion,
+                                         mpu6050_euler_t *p_euler)
+{
+    const mpu6050_quat_t *p_q;
+    float sin_pitch;
+
+    if (p_fusion == NULL || !p_fusion->is_initialized || p_euler == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_q = &p_fusion->q;
+
+    sin_pitch = 2.0f * (p_q->w * p_q->y - p_q->z * p_q->x);
+    if (sin_pitch > 1.0f) sin_pitch = 1.0f;
+    if (sin_pitch < -1.0f) sin_pitch = -1.0f;
+
+    p_euler->roll = atan2f(2.0f * (p_q->w * p_q->x + p_q->y * p_q->z),
+                           1.0f - 2.0f * (p_q->x * p_q->x + p_q->y * p_q->y)) * FUSION_DEG_PER_RAD;
+    p_euler->pitch = asinf(sin_pitch) * FUSION_DEG_PER_RAD;
+    p_euler->yaw = atan2f(2.0f * (p_q->w * p_q->z + p_q->x * p_q->y),
+                          1.0f - 2.0f * (p_q->y * p_q->y + p_q->z * p_q->z)) * FUSION_DEG_PER_RAD;
+
+    return DRV_OK;
+}
+#endif /* MPU6050_USE_FLOAT */
+
+/* --- 4. 私有函数实现 (Private Functions) --- */
+
+static void static_update_q(mpu6050_fusion_q_t *p_fusion, const mpu6050_fifo_sample_t *p_sample)
+{
+    int32_t q0 = p_fusion->q.w;
+    int32_t q1 = p_fusion->q.x;
+    int32_t q2 = p_fusion->q.y;
+    int32_t q3 = p_fusion->q.z;
+    int32_t ax = p_sample->accel.x;
+    int32_t ay = p_sample->accel.y;
+    int32_t az = p_sample->accel.z;
+    int32_t dx, dy, dz;
+    uint32_t norm;
+    int64_t n2;
+    int32_t inv;
+
+    /* 1. 陀螺仪半角增量 (Q30) */
+    dx = FUSION_ROUND_SHIFT((int64_t)p_sample->gyro.x * p_fusion->gyro_k, 16);
+    dy = FUSION_ROUND_SHIFT((int64_t)p_sample->gyro.y * p_fusion->gyro_k, 16);
+    dz = FUSION_ROUND_SHIFT((int64_t)p_sample->gyro.z * p_fusion->gyro_k, 16);
+
+    /* 2. 加速度方向与估计重力方向的叉积作为误差 (3 * 32768^2 不超过 uint32) */
+    norm = (uint32_t)(ax * ax) + (uint32_t)(ay * ay) + (uint32_t)(az * az);
+    if (norm != 0) {
+        int32_t vx, vy, vz;
+        int32_t ex, ey, ez;
+
+        norm = static_isqrt(norm);
+        ax = (ax * 16384) / (int32_t)norm;
+        ay = (ay * 16384) / (int32_t)norm;
+        az = (az * 16384) / (int32_t)norm;
+
+        vx = FUSION_ROUND_SHIFT(FUSION_Q30_MUL(q1, q3) - FUSION_Q30_MUL(q0, q2), 45);
+        vy = FUSION_ROUND_SHIFT(FUSION_Q30_MUL(q0, q1) + FUSION_Q30_MUL(q2, q3), 45);
+        vz = FUSION_ROUND_SHIFT(FUSION_Q30_MUL(q0, q0) - FUSION_Q30_MUL(q1, q1) -
+                                FUSION_Q30_MUL(q2, q2) + FUSION_Q30_MUL(q3, q3), 46);
+
+        ex = ay * vz - az * vy;
+        ey = az * vx - ax * vz;
+        ez = ax * vy - ay * vx;
+
+        if (p_fusion->ki_dt != 0) {
+            p_fusion->integral[0] += FUSION_ROUND_SHIFT(FUSION_Q30_MUL(ex, p_fusion->ki_dt), 28);
+            p_fusion->integral[1] += FUSION_ROUND_SHIFT(FUSION_Q30_MUL(ey, p_fusion->ki_dt), 28);
+            p_fusion->integral[2] += FUSION_ROUND_SHIFT(FUSION_Q30_MUL(ez, p_fusion->ki_dt), 28);
+            dx += FUSION_ROUND_SHIFT(FUSION_Q30_MUL(p_fusion->integral[0], p_fusion->half_dt), 30);
+            dy += FUSION_ROUND_SHIFT(FUSION_Q30_MUL(p_fusion->integral[1], p_fusion->half_dt), 30);
+            dz += FUSION_ROUND_SHIFT(FUSION_Q30_MUL(p_fusion->integral[2], p_fusion->half_dt), 30);
+        }
+
+        dx += FUSION_ROUND_SHIFT(FUSION_Q30_MUL(ex, p_fusion->kp_half_dt), 28);
+        dy += FUSION_ROUND_SHIFT(FUSION_Q30_MUL(ey, p_fusion->kp_half_dt), 28);
+        dz += FUSION_ROUND_SHIFT(FUSION_Q30_MUL(ez, p_fusion->kp_half_dt), 28);
+    }
+
+    /* 3. 四元数积分: q += q (x) (0, delta) */
+    p_fusion->q.w = q0 + FUSION_ROUND_SHIFT(-FUSION_Q30_MUL(q1, dx) - FUSION_Q30_MUL(q2, dy) -
+                                            FUSION_Q30_MUL(q3, dz), 30);
+    p_fusion->q.x = q1 + FUSION_ROUND_SHIFT(FUSION_Q30_MUL(q0, dx) + FUSION_Q30_MUL(q2, dz) -
+                                            FUSION_Q30_MUL(q3, dy), 30);
+    p_fusion->q.y = q2 + FUSION_ROUND_SHIFT(FUSION_Q30_MUL(q0, dy) - FUSION_Q30_MUL(q1, dz) +
+                                            FUSION_Q30_MUL(q3, dx), 30);
+    p_fusion->q.z = q3 + FUSION_ROUND_SHIFT(FUSION_Q30_MUL(q0, dz) + FUSION_Q30_MUL(q1, dy) -
+                                            FUSION_Q30_MUL(q2, dx), 30);
+
+    /*
+     * 4. 归一化: 每步模长偏离 1 的量是 delta^2 量级, 一次牛顿迭代
+     *    1/sqrt(n) ~= (3 - n) / 2 即可, 无需开方和除法
+     */
+    n2 = (FUSION_Q30_MUL(p_fusion->q.w, p_fusion->q.w) + FUSION_Q30_MUL(p_fusion->q.x, p_fusion->q.x) +
+          FUSION_Q30_MUL(p_fusion->q.y, p_fusion->q.y) + FUSION_Q30_MUL(p_fusion->q.z, p_fusion->q.z)) >> 30;
+    inv = (int32_t)((((int64_t)3 << 30) - n2) >> 1);
+
+    p_fusion->q.w = FUSION_ROUND_SHIFT(FUSION_Q30_MUL(p_fusion->q.w, inv), 30);
+    p_fusion->q.x = FUSION_ROUND_SHIFT(FUSION_Q30_MUL(p_fusion->q.x, inv), 30);
+    p_fusion->q.y = FUSION_ROUND_SHIFT(FUSION_Q30_MUL(p_fusion->q.y, inv), 30);
+    p_fusion->q.z = FUSION_ROUND_SHIFT(FUSION_Q30_MUL(p_fusion->q.z, inv), 30);
+}
+
+static uint32_t static_isqrt(uint32_t value)
+{
+    uint32_t result = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return result;
+}
+
+/**
+ * @brief 定点 atan2, 输入为同一比例的 Q15 左右的整数, 输出 0.01 度
+ * @note  第一象限内 atan(z) ~= pi/4 * z + z * (1 - z) * (0.2447 + 0.0663 * z), 误差 < 0.1 度
+ */
+static int32_t static_atan2_cdeg(int32_t y, int32_t x)
+{
+    int32_t abs_y = (y < 0) ? -y : y;
+    int32_t abs_x = (x < 0) ? -x : x;
+    int32_t z;
+    int32_t angle;
+    bool swapped = false;
+
+    if (abs_x == 0 && abs_y == 0) {
+        return 0;
+    }
+
+    /* 输入可能略超过 2^15 (叉积未归一化), 降到 2^16 以内保证移位不溢出 */
+    while (abs_x > 65535 || abs_y > 65535) {
+        abs_x >>= 1;
+        abs_y >>= 1;
+    }
+
+    if (abs_y > abs_x) {
+        z = abs_x;
+        abs_x = abs_y;
+        abs_y = z;
+        swapped = true;
+    }
+
+    z = (abs_y << 15) / abs_x;   /* Q15, 0 ~ 1 */
+
+    /* 4500 * z + z * (1 - z) * (1402 + 380 * z), 系数已换算为 0.01 度 */
+    angle = (4500 * z) >> 15;
+    angle += (int32_t)(((int64_t)(1402 + ((380 * z) >> 15)) * ((z * (int64_t)(32768 - z)) >> 15)) >> 15);
+
+    if (swapped) angle = FUSION_CDEG_90 - angle;
+    if (x < 0) angle = FUSION_CDEG_180 - angle;
+    if (y < 0) angle = -angle;
+
+    return angle;
+}
+
+#if MPU6050_USE_FLOAT
+static void static_update_mahony(mpu6050_fusion_t *p_fusion, const mpu6050_fifo_sample_t *p_sample)
+{
+    mpu6050_quat_t *p_q = &p_fusion->q;
+    float q0 = p_q->w, q1 = p_q->x, q2 = p_q->y, q3 = p_q->z;
+    float ax = (float)p_sample->accel.x;
+    float ay = (float)p_sample->accel.y;
+    float az = (float)p_sample->accel.z;
+    float gx = (float)p_sample->gyro.x * p_fusion->gyro_scale;
+    float gy = (float)p_sample->gyro.y * p_fusion->gyro_scale;
+    float gz = (float)p_sample->gyro.z * p_fusion->gyro_scale;
+    float half_dt = 0.5f * p_fusion->dt;
+    float norm;
+
+    if (p_sample->accel.x != 0 || p_sample->accel.y != 0 || p_sample->accel.z != 0) {
+        float vx, vy, vz;
+        float ex, ey, ez;
+
+        norm = 1.0f / sqrtf(ax * ax + ay * ay + az * az);
+        ax *= norm;
+        ay *= norm;
+        az *= norm;
+
+        /* 估计重力方向 (四元数旋转矩阵第三行) */
+        vx = 2.0f * (q1 * q3 - q0 * q2);
+        vy = 2.0f * (q0 * q1 + q2 * q3);
+        vz = q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3;
+
+        ex = ay * vz - az * vy;
+        ey = az * vx - ax * vz;
+        ez = ax * vy - ay * vx;
+
+        if (p_fusion->config.ki > 0.0f) {
+            p_fusion->integral[0] += p_fusion->config.ki * ex * p_fusion->dt;
+            p_fusion->integral[1] += p_fusion->config.ki * ey * p_fusion->dt;
+            p_fusion->integral[2] += p_fusion->config.ki * ez * p_fusion->dt;
+            gx += p_fusion->integral[0];
+            gy += p_fusion->integral[1];
+            gz += p_fusion->integral[2];
+        }
+
+        gx += p_fusion->config.kp * ex;
+        gy += p_fusion->config.kp * ey;
+        gz += p_fusion->config.kp * ez;
+    }
+
+    gx *= half_dt;
+    gy *= half_dt;
+    gz *= half_dt;
+
+    q0 += -p_q->x * gx - p_q->y * gy - p_q->z * gz;
+    q1 += p_q->w * gx + p_q->y * gz - p_q->z * gy;
+    q2 += p_q->w * gy - p_q->x * gz + p_q->z * gx;
+    q3 += p_q->w * gz + p_q->x * gy - p_q->y * gx;
+
+    norm = 1.0f / sqrtf(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+    p_q->w = q0 * norm;
+    p_q->x = q1 * norm;
+    p_q->y = q2 * norm;
+    p_q->z = q3 * norm;
+}
+
+static void static_update_madgwick(mpu6050_fusion_t *p_fusion, const mpu6050_fifo_sample_t *p_sample)
+{
+    mpu6050_quat_t *p_q = &p_fusion->q;
+    float q0 = p_q->w, q1 = p_q->x, q2 = p_q->y, q3 = p_q->z;
+    float gx = (float)p_sample->gyro.x * p_fusion->gyro_scale;
+    float gy = (float)p_sample->gyro.y * p_fusion->gyro_scale;
+    float gz = (float)p_sample->gyro.z * p_fusion->gyro_scale;
+    float dq0, dq1, dq2, dq3;
+    float norm;
+
+    /* 陀螺仪给出的四元数变化率 */
+    dq0 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+    dq1 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+    dq2 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+    dq3 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+
+    if (p_sample->accel.x != 0 || p_sample->accel.y != 0 || p_sample->accel.z != 0) {
+        float ax = (float)p_sample->accel.x;
+        float ay = (float)p_sample->accel.y;
+        float az = (float)p_sample->accel.z;
+        float s0, s1, s2, s3;
+        float q0q0 = q0 * q0, q1q1 = q1 * q1, q2q2 = q2 * q2, q3q3 = q3 * q3;
+
+        norm = 1.0f / sqrtf(ax * ax + ay * ay + az * az);
+        ax *= norm;
+        ay *= norm;
+        az *= norm;
+
+        /* 目标函数梯度 (重力方向误差的雅可比转置乘残差) */
+        s0 = 4.0f * q0 * (q2q2 + q1q1) + 2.0f * (q2 * ax - q1 * ay);
+        s1 = 4.0f * q1 * (q3q3 + q0q0 - 1.0f + 2.0f * (q1q1 + q2q2) + az) - 2.0f * (q3 * ax + q0 * ay);
+        s2 = 4.0f * q2 * (q0q0 + q3q3 - 1.0f + 2.0f * (q1q1 + q2q2) + az) + 2.0f * (q0 * ax - q3 * ay);
+        s3 = 4.0f * q3 * (q1q1 + q2q2) - 2.0f * (q1 * ax + q2 * ay);
+
+        norm = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+        if (norm > 0.0f) {
+            norm = p_fusion->config.beta / sqrtf(norm);
+            dq0 -= s0 * norm;
+            dq1 -= s1 * norm;
+            dq2 -= s2 * norm;
+            dq3 -= s3 * norm;
+        }
+    }
+
+    q0 += dq0 * p_fusion->dt;
+    q1 += dq1 * p_fusion->dt;
+    q2 += dq2 * p_fusion->dt;
+    q3 += dq3 * p_fusion->dt;
+
+    norm = 1.0f / sqrtf(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+    p_q->w = q0 * norm;
+    p_q->x = q1 * norm;
+    p_q->y = q2 * norm;
+    p_q->z = q3 * norm;
+}
+#endif /* MPU6050_USE_FLOAT */
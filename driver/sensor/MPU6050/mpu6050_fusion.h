@@ -0,0 +1,243 @@
+/**
+ * @file mpu6050_fusion.h
+ * @brief MPU6050 姿态融合 (Orientation Fusion)
+ * @note  以传感器采样率更新姿态四元数, 按需计算欧拉角 (roll/pitch/yaw).
+ *        输入直接使用原始样本 (mpu6050_fifo_sample_t), 加速度只用于方向, 无需换算;
+ *        陀螺仪比例与采样周期 dt 在初始化时由设备量程和 sample_rate_div 预先计算.
+ *        - 浮点实现: Mahony (PI 互补滤波) 与 Madgwick (梯度下降), MPU6050_USE_FLOAT 为1时提供
+ *        - 定点实现: Mahony, 四元数 Q30, 无 FPU 的 Cortex-M0/M3 可用
+ *        没有磁力计, yaw 只由陀螺仪积分, 会随零偏缓慢漂移.
+ *
+ * @section fusion_cost 每次更新开销
+ * | 实现 | 主要运算 | Cortex-M4F 估算 (周期) | 主机实测 (x86-64, gcc -O2) |
+ * | :--- | :--- | :--- | :--- |
+ * | Mahony 浮点 | 约 50 乘, 30 加, 2 开方, 2 除 | 约 200 | 约 41 ns |
+ * | Madgwick 浮点 | 约 75 乘, 50 加, 3 开方, 3 除 | 约 270 | 约 51 ns |
+ * | Mahony 定点 | 约 35 次 32x32->64 乘, 1 整数开方, 3 除 | 约 400 (不使用 FPU) | 约 92 ns |
+ * M4F 估算按 VMUL/VADD/VCVT 1 周期, VSQRT/VDIV 14 周期, SMULL 1 周期, 64 位加移位 2~3 周期,
+ * 另加载入/存储; 仅用于预算, 部署前请用 DWT->CYCCNT 在目标板上实测.
+ * 按此估算, 168MHz M4F 上 1kHz 更新占用 CPU 约 0.1% ~ 0.25%.
+ * 定点实现在 Cortex-M0 上 64 位乘法为库函数调用, 开销约为上表的 5 倍.
+ * 欧拉角只在调用 get_euler 时计算 (含 atan2/asin), 不计入上表.
+ */
+
+#ifndef _MPU6050_FUSION_H_
+#define _MPU6050_FUSION_H_
+
+#include "mpu6050_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#define MPU6050_FUSION_Q_ONE   (1L << 30)  /**< 定点四元数的 1.0 (Q30) */
+
+/* --- 2. 数据结构 (Data Structures) --- */
+
+/**
+ * @brief 定点四元数 (Q30)
+ */
+typedef struct {
+    int32_t w, x, y, z;
+} mpu6050_quat_q30_t;
+
+/**
+ * @brief 定点欧拉角 (单位 0.01 度)
+ */
+typedef struct {
+    int32_t roll;   /**< 绕 X 轴, -18000 ~ 18000 */
+    int32_t pitch;  /**< 绕 Y 轴, -9000 ~ 9000 */
+    int32_t yaw;    /**< 绕 Z 轴, -18000 ~ 18000 */
+} mpu6050_euler_cdeg_t;
+
+/**
+ * @brief 定点 Mahony 融合状态 (由 mpu6050_fusion_q_init 预先计算系数)
+ */
+typedef struct {
+    mpu6050_quat_q30_t q;   /**< 姿态四元数 */
+    int32_t integral[3];    /**< 误差积分 (rad/s, Q30) */
+    int32_t gyro_k;         /**< 每 LSB 对应的半角增量 (rad, Q46) */
+    int32_t kp_half_dt;     /**< kp * dt / 2 (Q30) */
+    int32_t ki_dt;          /**< ki * dt (Q30) */
+    int32_t half_dt;        /**< dt / 2 (s, Q30) */
+    bool    is_initialized; /**< 初始化标志 */
+} mpu6050_fusion_q_t;
+
+#if MPU6050_USE_FLOAT
+/**
+ * @brief 浮点融合算法
+ */
+typedef enum {
+    MPU6050_FUSION_MAHONY = 0,   /**< PI 互补滤波, 运算量小, ki 可在线估计陀螺零偏 */
+    MPU6050_FUSION_MADGWICK,     /**< 梯度下降, 单参数 beta */
+} mpu6050_fusion_algo_t;
+
+/**
+ * @brief 浮点融合配置
+ */
+typedef struct {
+    mpu6050_fusion_algo_t algo;  /**< 算法 */
+    float kp;                    /**< Mahony 比例增益 (1/s) */
+    float ki;                    /**< Mahony 积分增益 (1/s^2), 0 关闭积分 */
+    float beta;                  /**< Madgwick 增益 (rad/s) */
+} mpu6050_fusion_config_t;
+
+/** 默认配置: Mahony, kp = 1.0, ki = 0 */
+#define MPU6050_FUSION_DEFAULT_CONFIG { MPU6050_FUSION_MAHONY, 1.0f, 0.0f, 0.1f }
+
+/**
+ * @brief 浮点四元数
+ */
+typedef struct {
+    float w, x, y, z;
+} mpu6050_quat_t;
+
+/**
+ * @brief 浮点欧拉角 (单位 度)
+ */
+typedef struct {
+    float roll;
+    float pitch;
+    float yaw;
+} mpu6050_euler_t;
+
+/**
+ * @brief 浮点融合状态
+ */
+typedef struct {
+    mpu6050_fusion_config_t config;  /**< 配置副本 */
+    mpu6050_quat_t q;                /**< 姿态四元数 */
+    float integral[3];               /**< Mahony 误差积分 (rad/s) */
+    float gyro_scale;                /**< rad/s/LSB */
+    float dt;                        /**< 采样周期 (s) */
+    bool  is_initialized;            /**< 初始化标志 */
+} mpu6050_fusion_t;
+#endif /* MPU6050_USE_FLOAT */
+
+/* --- 3. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 初始化定点 Mahony 融合
+ * @param p_fusion 融合状态指针
+ * @param p_dev 已初始化的设备句柄 (读取陀螺仪量程与采样周期)
+ * @param kp_q16 比例增益 (Q16.16, 如 0.5 = 32768)
+ * @param ki_q16 积分增益 (Q16.16), 0 关闭积分
+ * @return driver_status_t
+ * @retval DRV_ERR_INVALID_VAL 系数超出定点范围: kp * dt / 2 或 ki * dt 不小于 2,
+ *         或采样周期过长 (±2000dps 时超过约 57ms, ±250dps 时超过约 458ms, 如低功耗循环模式)
+ * @note  量程或采样率改变后需重新初始化 (姿态会复位)
+ */
+driver_status_t mpu6050_fusion_q_init(mpu6050_fusion_q_t *p_fusion,
+                                      const mpu6050_dev_t *p_dev,
+                                      uint32_t kp_q16,
+                                      uint32_t ki_q16);
+
+/**
+ * @brief 复位姿态为单位四元数并清除积分
+ * @param p_fusion 融合状态指针
+ */
+void mpu6050_fusion_q_reset(mpu6050_fusion_q_t *p_fusion);
+
+/**
+ * @brief 定点更新 (单个样本)
+ * @param p_fusion 融合状态指针
+ * @param p_sample 原始样本 (加速度全零时只做陀螺仪积分)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fusion_q_update(mpu6050_fusion_q_t *p_fusion,
+                                        const mpu6050_fifo_sample_t *p_sample);
+
+/**
+ * @brief 定点批量更新 (如 mpu6050_fifo_read 一次读出的样本块)
+ * @param p_fusion 融合状态指针
+ * @param p_samples 样本数组 (按时间顺序)
+ * @param count 样本数
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fusion_q_update_batch(mpu6050_fusion_q_t *p_fusion,
+                                              const mpu6050_fifo_sample_t *p_samples,
+                                              uint16_t count);
+
+/**
+ * @brief 获取定点四元数
+ * @param p_fusion 融合状态指针
+ * @param p_quat 输出四元数
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fusion_q_get_quat(const mpu6050_fusion_q_t *p_fusion,
+                                          mpu6050_quat_q30_t *p_quat);
+
+/**
+ * @brief 获取定点欧拉角
+ * @param p_fusion 融合状态指针
+ * @param p_euler 输出欧拉角 (0.01 度, 多项式 atan 近似, 误差约 0.1 度)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fusion_q_get_euler(const mpu6050_fusion_q_t *p_fusion,
+                                           mpu6050_euler_cdeg_t *p_euler);
+
+#if MPU6050_USE_FLOAT
+/**
+ * @brief 初始化浮点融合
+ * @param p_fusion 融合状态指针
+ * @param p_dev 已初始化的设备句柄 (读取陀螺仪量程与采样周期)
+ * @param p_config 融合配置 (NULL 使用默认配置)
+ * @return driver_status_t
+ * @note  量程或采样率改变后需重新初始化 (姿态会复位)
+ */
+driver_status_t mpu6050_fusion_init(mpu6050_fusion_t *p_fusion,
+                                    const mpu6050_dev_t *p_dev,
+                                    const mpu6050_fusion_config_t *p_config);
+
+/**
+ * @brief 复位姿态为单位四元数并清除积分
+ * @param p_fusion 融合状态指针
+ */
+void mpu6050_fusion_reset(mpu6050_fusion_t *p_fusion);
+
+/**
+ * @brief 浮点更新 (单个样本)
+ * @param p_fusion 融合状态指针
+ * @param p_sample 原始样本 (加速度全零时只做陀螺仪积分)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fusion_update(mpu6050_fusion_t *p_fusion,
+                                      const mpu6050_fifo_sample_t *p_sample);
+
+/**
+ * @brief 浮点批量更新 (如 mpu6050_fifo_read 一次读出的样本块)
+ * @param p_fusion 融合状态指针
+ * @param p_samples 样本数组 (按时间顺序)
+ * @param count 样本数
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fusion_update_batch(mpu6050_fusion_t *p_fusion,
+                                            const mpu6050_fifo_sample_t *p_samples,
+                                            uint16_t count);
+
+/**
+ * @brief 获取浮点四元数
+ * @param p_fusion 融合状态指针
+ * @param p_quat 输出四元数
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fusion_get_quat(const mpu6050_fusion_t *p_fusion,
+                                        mpu6050_quat_t *p_quat);
+
+/**
+ * @brief 获取浮点欧拉角
+ * @param p_fusion 融合状态指针
+ * @param p_euler 输出欧拉角 (度)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_fusion_get_euler(const mpu6050_fusion_t *p_fusion,
+                                         mpu6050_euler_t *p_euler);
+#endif /* MPU6050_USE_FLOAT */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MPU6050_FUSION_H_ */
@@ -0,0 +1,362 @@
+/**
+ * @file mpu6050_group.c
+ * @brief MPU6050 多设备同步采集实现
+ */
+
+#include "mpu6050_group.h"
+#include <string.h>
+
+/* --- 1. 私有宏定义 (Private Macros) --- */
+
+/* 估计的采样周期与配置值的最大偏差 (1/20 = 5%), 超出视为主机时钟异常, 保持原估计 */
+#define GROUP_PERIOD_TOLERANCE_DIV  20U
+
+/*
+ * 对齐: 成员 FIFO 比最慢的成员多出的帧数 (领先量) 受采样相位与查询先后影响, 单次只能精确到 ±1 帧.
+ * 用 alpha-beta 滤波 (Q16) 跟踪领先量及其每次读取的变化率, 时钟偏差造成的线性漂移没有滞后;
+ * 估计值超过 0.75 帧时丢弃 1 帧并减去 1 帧, 留出迟滞, 避免两个成员在 0.5 帧附近轮流丢帧.
+ * 单次领先 2 帧以上 (启动或长时间未读取) 时立即丢弃到只剩 1 帧
+ */
+#define GROUP_DROP_LEAD             2U
+#define GROUP_LEAD_ONE_Q16          65536L
+#define GROUP_LEAD_DROP_Q16         49152L
+#define GROUP_LEAD_ALPHA_DIV        4
+#define GROUP_LEAD_BETA_DIV         32
+
+/* --- 2. 私有函数声明 (Private Functions) --- */
+
+static driver_status_t static_select(mpu6050_group_t *p_group, uint8_t index);
+static driver_status_t static_restart(mpu6050_group_t *p_group);
+static void static_update_period(mpu6050_group_t *p_group, uint32_t tick, uint32_t total);
+static uint32_t static_get_tick(const mpu6050_group_t *p_group);
+static void static_track_lead(mpu6050_group_member_t *p_member, uint16_t lead);
+
+/* --- 3. 公共函数实现 (Public Functions) --- */
+
+driver_status_t mpu6050_group_init(mpu6050_group_t *p_group, mpu6050_group_select_t select, void *select_ctx)
+{
+    if (p_group == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    memset(p_group, 0, sizeof(mpu6050_group_t));
+    p_group->select = select;
+    p_group->select_ctx = select_ctx;
+    p_group->current_channel = MPU6050_GROUP_NO_CHANNEL;
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_group_add(mpu6050_group_t *p_group, mpu6050_dev_t *p_dev, uint8_t channel)
+{
+    mpu6050_group_member_t *p_member;
+
+    if (p_group == NULL || p_dev == NULL || !p_dev->is_initialized) {
+        return DRV_ERR_INVALID_VAL;
+    }
+    if (p_group->is_running) {
+        return DRV_ERR_BUSY;
+    }
+    if (p_group->count >= MPU6050_GROUP_MAX_MEMBERS) {
+        return DRV_ERR_NO_MEM;
+    }
+
+    p_member = &p_group->members[p_group->count];
+    memset(p_member, 0, sizeof(mpu6050_group_member_t));
+    p_member->p_dev = p_dev;
+    p_member->channel = channel;
+    p_group->count++;
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_group_select(mpu6050_group_t *p_group, uint8_t index)
+{
+    if (p_group == NULL || index >= p_group->count) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    return static_select(p_group, index);
+}
+
+driver_status_t mpu6050_group_start(mpu6050_group_t *p_group, uint8_t sensors)
+{
+    mpu6050_dev_t *p_dev;
+    mpu6050_config_t cfg;
+    mpu6050_dlpf_cfg_t dlpf_cfg;
+    uint32_t period_us;
+    uint8_t i;
+    driver_status_t status;
+
+    if (p_group == NULL || p_group->count == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+    if (p_group->is_running) {
+        return DRV_ERR_BUSY;
+    }
+
+    /* 所有成员的采样周期与 DLPF 必须一致, 否则无法按组对齐 (本函数不修改成员配置) */
+    mpu6050_get_config(p_group->members[0].p_dev, &cfg);
+    dlpf_cfg = cfg.dlpf_cfg;
+    period_us = mpu6050_get_sample_period_us(p_group->members[0].p_dev);
+    for (i = 0; i < p_group->count; i++) {
+        p_dev = p_group->members[i].p_dev;
+        if (p_dev->drdy.is_active || p_dev->wom.is_active) {
+            return DRV_ERR_BUSY;
+        }
+        mpu6050_get_config(p_dev, &cfg);
+        if (mpu6050_get_sample_period_us(p_dev) != period_us || cfg.dlpf_cfg != dlpf_cfg) {
+            return DRV_ERR_INVALID_VAL;
+        }
+    }
+
+    for (i = 0; i < p_group->count; i++) {
+        status = static_select(p_group, i);
+        if (status == DRV_OK) {
+            status = mpu6050_fifo_enable(p_group->members[i].p_dev, sensors);
+        }
+        if (status != DRV_OK) {
+            /* 关闭已使能的成员 */
+            while (i > 0) {
+                i--;
+                if (static_select(p_group, i) == DRV_OK) {
+                    mpu6050_fifo_disable(p_group->members[i].p_dev);
+                }
+            }
+            return status;
+        }
+    }
+
+    for (i = 0; i < p_group->count; i++) {
+        p_group->members[i].dropped = 0;
+    }
+    p_group->nominal_period_us = period_us;
+    p_group->period_ns = period_us * 1000U;
+    p_group->resync_count = 0;
+    p_group->is_running = true;
+
+    /* 使能过程每个成员需要多次传输, 最后再依次清空, 使 FIFO 起点只相差一次清空的时间 */
+    status = static_restart(p_group);
+    if (status != DRV_OK) {
+        mpu6050_group_stop(p_group);
+    }
+    return status;
+}
+
+driver_status_t mpu6050_group_stop(mpu6050_group_t *p_group)
+{
+    driver_status_t status = DRV_OK;
+    uint8_t i;
+
+    if (p_group == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    for (i = 0; i < p_group->count; i++) {
+        if (static_select(p_group, i) != DRV_OK ||
+            mpu6050_fifo_disable(p_group->members[i].p_dev) != DRV_OK) {
+            status = DRV_ERR_IO;
+        }
+    }
+
+    p_group->is_running = false;
+    return status;
+}
+
+driver_status_t mpu6050_group_read(mpu6050_group_t *p_group,
+                                   mpu6050_fifo_sample_t *p_samples,
+                                   uint32_t *p_timestamps,
+                                   uint16_t max_sets,
+                                   uint16_t *p_sets)
+{
+    mpu6050_group_member_t *p_member;
+    mpu6050_fifo_sample_t *p_block;
+    uint16_t min_frames = 0xFFFF;
+    uint16_t sets;
+    uint16_t lead;
+    uint16_t drop;
+    uint16_t chunk;
+    uint16_t frame_size;
+    uint32_t tick;
+    uint32_t ts;
+    uint8_t i;
+    uint16_t k;
+
+    if (p_group == NULL || p_samples == NULL || p_sets == NULL || max_sets == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+    *p_sets = 0;
+    if (!p_group->is_running) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    /* 1. 依次查询所有成员的 FIFO 计数, 快照时刻尽量接近 */
+    for (i = 0; i < p_group->count; i++) {
+        p_member = &p_group->members[i];
+        if (static_select(p_group, i) != DRV_OK ||
+            mpu6050_fifo_get_count(p_member->p_dev, &p_member->frames) != DRV_OK) {
+            return DRV_ERR_IO;
+        }
+
+        /* 剩余空间不足一帧时可能已经覆盖旧数据, 各成员之间无法再按序号对齐 */
+        frame_size = p_member->p_dev->fifo_frame_size;
+        if ((uint32_t)p_member->frames * frame_size > (uint32_t)(MPU6050_FIFO_SIZE - frame_size)) {
+            p_group->resync_count++;
+            return (static_restart(p_group) == DRV_OK) ? DRV_ERR_NO_MEM : DRV_ERR_IO;
+        }
+
+        if (p_member->frames < min_frames) {
+            min_frames = p_member->frames;
+        }
+    }
+    tick = static_get_tick(p_group);
+
+    /* 2. 最慢的成员决定节奏: 已输出的组数加上其 FIFO 中的帧数即为起点以来产生的样本数 */
+    static_update_period(p_group, tick, p_group->sets + min_frames);
+    sets = (min_frames < max_sets) ? min_frames : max_sets;
+
+    /* 3. 逆序读取数据: 第一个访问的成员与计数阶段最后一个相同, 复用器少切换一次 */
+    i = p_group->count;
+    while (i > 0) {
+        i--;
+        p_member = &p_group->members[i];
+        p_block = &p_samples[(uint32_t)i * max_sets];
+
+        if (static_select(p_group, i) != DRV_OK) {
+            static_restart(p_group);
+            return DRV_ERR_IO;
+        }
+
+        /* 时钟较快的成员多产生的帧是最旧的, 丢弃后其后续样本与其他成员在时间上对齐 */
+        lead = (uint16_t)(p_member->frames - min_frames);
+        drop = 0;
+        if (lead >= GROUP_DROP_LEAD) {
+            drop = (uint16_t)(lead - (GROUP_DROP_LEAD - 1U));
+            lead = GROUP_DROP_LEAD - 1U;
+            p_member->lead_q16 -= (int32_t)drop * GROUP_LEAD_ONE_Q16;
+        }
+        static_track_lead(p_member, lead);
+        if (lead > 0 && p_member->lead_q16 >= GROUP_LEAD_DROP_Q16) {
+            drop++;
+            p_member->lead_q16 -= GROUP_LEAD_ONE_Q16;
+        }
+        p_member->dropped += drop;
+        while (drop > 0) {
+            chunk = (drop < max_sets) ? drop : max_sets;
+            if (mpu6050_fifo_read_frames(p_member->p_dev, p_block, chunk) != DRV_OK) {
+                static_restart(p_group);
+                return DRV_ERR_IO;
+            }
+            drop = (uint16_t)(drop - chunk);
+        }
+
+        if (mpu6050_fifo_read_frames(p_member->p_dev, p_block, sets) != DRV_OK) {
+            static_restart(p_group);
+            return DRV_ERR_IO;
+        }
+    }
+
+    /* 4. 重建时间戳: 第 k 组位于起点之后 k + 1 个采样周期, 并保证单调递增 */
+    if (p_timestamps != NULL) {
+        for (k = 0; k < sets; k++) {
+            ts = (uint32_t)(p_group->start_tick * 1000U +
+                            (uint32_t)(((uint64_t)(p_group->sets + k + 1U) * p_group->period_ns) / 1000U));
+            if ((int32_t)(ts - p_group->last_ts_us) <= 0 && (p_group->sets + k) > 0) {
+                ts = p_group->last_ts_us + 1U;
+            }
+            p_timestamps[k] = ts;
+            p_group->last_ts_us = ts;
+        }
+    }
+
+    p_group->sets += sets;
+    *p_sets = sets;
+    return DRV_OK;
+}
+
+/* --- 4. 私有函数实现 (Private Functions) --- */
+
+/**
+ * @brief 选中成员所在的复用器通道, 与当前通道相同时不产生传输
+ */
+static driver_status_t static_select(mpu6050_group_t *p_group, uint8_t index)
+{
+    uint8_t channel = p_group->members[index].channel;
+
+    if (p_group->select == NULL || channel == MPU6050_GROUP_NO_CHANNEL ||
+        channel == p_group->current_channel) {
+        return DRV_OK;
+    }
+
+    if (p_group->select(p_group->select_ctx, channel) != DRV_OK) {
+        p_group->current_channel = MPU6050_GROUP_NO_CHANNEL;
+        return DRV_ERR_IO;
+    }
+
+    p_group->current_channel = channel;
+    return DRV_OK;
+}
+
+/**
+ * @brief 依次清空所有成员的 FIFO, 以此作为新的共同起点
+ */
+static driver_status_t static_restart(mpu6050_group_t *p_group)
+{
+    uint8_t i;
+
+    for (i = 0; i < p_group->count; i++) {
+        if (static_select(p_group, i) != DRV_OK ||
+            mpu6050_fifo_reset(p_group->members[i].p_dev) != DRV_OK) {
+            return DRV_ERR_IO;
+        }
+        p_group->members[i].frames = 0;
+        p_group->members[i].lead_q16 = 0;
+        p_group->members[i].rate_q16 = 0;
+    }
+
+    p_group->start_tick = static_get_tick(p_group);
+    p_group->sets = 0;
+    return DRV_OK;
+}
+
+/**
+ * @brief 按主机时钟估计实际采样周期
+ * @param tick 计数快照时刻 (ms)
+ * @param total FIFO 起点以来最慢成员产生的样本数
+ */
+static void static_update_period(mpu6050_group_t *p_group, uint32_t tick, uint32_t total)
+{
+    uint32_t elapsed_ms = tick - p_group->start_tick;
+    uint32_t nominal_ns = p_group->nominal_period_us * 1000U;
+    uint32_t tolerance_ns = nominal_ns / GROUP_PERIOD_TOLERANCE_DIV;
+    uint32_t period_ns;
+
+    if (p_group->members[0].p_dev->time_ops.get_tick == NULL ||
+        elapsed_ms < MPU6050_GROUP_RATE_WINDOW_MS || total == 0) {
+        return;
+    }
+
+    period_ns = (uint32_t)(((uint64_t)elapsed_ms * 1000000U + total / 2U) / total);
+    if (period_ns + tolerance_ns < nominal_ns || period_ns > nominal_ns + tolerance_ns) {
+        return;
+    }
+    p_group->period_ns = period_ns;
+}
+
+/**
+ * @brief alpha-beta 滤波更新领先量估计
+ * @param lead 本次测得的领先帧数 (已扣除立即丢弃的帧)
+ */
+static void static_track_lead(mpu6050_group_member_t *p_member, uint16_t lead)
+{
+    int32_t predicted = p_member->lead_q16 + p_member->rate_q16;
+    int32_t residual = (int32_t)lead * GROUP_LEAD_ONE_Q16 - predicted;
+
+    p_member->lead_q16 = predicted + residual / GROUP_LEAD_ALPHA_DIV;
+    p_member->rate_q16 += residual / GROUP_LEAD_BETA_DIV;
+}
+
+static uint32_t static_get_tick(const mpu6050_group_t *p_group)
+{
+    const mpu6050_dev_t *p_dev = p_group->members[0].p_dev;
+
+    return (p_dev->time_ops.get_tick != NULL) ? p_dev->time_ops.get_tick() : 0;
+}
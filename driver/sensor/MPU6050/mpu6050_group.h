@@ -0,0 +1,170 @@
+/**
+ * @file mpu6050_group.h
+ * @brief MPU6050 多设备同步采集 (Multi-IMU Group)
+ * @note  同一总线上的多个 MPU6050 (0x68/0x69, 或经 I2C 多路复用器扩展) 以相同采样周期写入各自的 FIFO,
+ *        每次读取按交错调度访问总线: 先依次查询所有设备的 FIFO 计数 (快照时刻相近),
+ *        再逆序批量读出相同数量的帧 (复用器只在相邻设备通道不同时切换),
+ *        输出按样本组对齐的数据与重建的时间戳.
+ *        - 对齐: 各芯片时钟独立 (偏差可达 ±1%), 跟踪每个设备相对最慢设备的领先帧数, 较快的设备丢弃最旧的帧,
+ *          同一组内样本的时间差通常小于1个采样周期 (芯片之间没有公共时钟, 无法做到相位一致)
+ *        - 时间戳: 第 k 组 = FIFO 起点 + (k + 1) * 采样周期; 提供 get_tick 时启动
+ *          MPU6050_GROUP_RATE_WINDOW_MS 后用主机时钟在线估计实际周期 (基线越长越准), 输出保持单调递增
+ *          (按 32 位模运算: 时间戳为 uint32_t 微秒, 约每 71.6 分钟回绕一次)
+ *
+ * @section group_usage 使用示例
+ * @code
+ * mpu6050_group_t group;
+ * mpu6050_fifo_sample_t samples[2 * 32];   // 成员数 * max_sets, 按成员分块
+ * uint32_t ts[32];                          // us, 约 71.6 分钟回绕, 用 (int32_t)(ts[i] - ts[j]) 求差
+ * uint16_t sets;
+ *
+ * // imu_a / imu_b 已用相同的 DLPF 与分频初始化
+ * mpu6050_group_init(&group, NULL, NULL);  // 无复用器
+ * mpu6050_group_add(&group, &imu_a, MPU6050_GROUP_NO_CHANNEL);
+ * mpu6050_group_add(&group, &imu_b, MPU6050_GROUP_NO_CHANNEL);
+ * mpu6050_group_start(&group, MPU6050_FIFO_ACCEL | MPU6050_FIFO_GYRO);
+ *
+ * if (mpu6050_group_read(&group, samples, ts, 32, &sets) == DRV_OK) {
+ *     for (i = 0; i < sets; i++) {
+ *         diff = samples[i].accel.z - samples[32 + i].accel.z;   // 成员0与成员1的第i组
+ *     }
+ * }
+ * @endcode
+ */
+
+#ifndef _MPU6050_GROUP_H_
+#define _MPU6050_GROUP_H_
+
+#include "mpu6050_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#ifndef MPU6050_GROUP_MAX_MEMBERS
+#define MPU6050_GROUP_MAX_MEMBERS    4     /**< 每组最多设备数 */
+#endif
+
+#define MPU6050_GROUP_NO_CHANNEL     0xFF  /**< 设备直接挂在总线上, 不经过复用器 */
+#define MPU6050_GROUP_RATE_WINDOW_MS 1000  /**< 启动后至少经过该时间才用主机时钟估计采样周期 */
+
+/* --- 2. 数据结构 (Data Structures) --- */
+
+/**
+ * @brief 复用器通道选择函数 (如写 TCA9548A 控制寄存器)
+ * @param ctx 用户上下文
+ * @param channel 通道号
+ * @return driver_status_t
+ */
+typedef driver_status_t (*mpu6050_group_select_t)(void *ctx, uint8_t channel);
+
+/**
+ * @brief 组成员 (驱动内部使用)
+ */
+typedef struct {
+    mpu6050_dev_t *p_dev;     /**< 已初始化的设备句柄 */
+    uint8_t  channel;         /**< 复用器通道 (MPU6050_GROUP_NO_CHANNEL 表示不经过复用器) */
+    uint16_t frames;          /**< 本次查询到的 FIFO 帧数 */
+    int32_t  lead_q16;        /**< 相对最慢成员的领先帧数估计 (Q16) */
+    int32_t  rate_q16;        /**< 领先帧数每次读取的变化率 (Q16) */
+    uint32_t dropped;         /**< 为对齐丢弃的帧数 */
+} mpu6050_group_member_t;
+
+/**
+ * @brief 多设备组
+ * @note  内存由调用者管理
+ */
+typedef struct {
+    mpu6050_group_member_t members[MPU6050_GROUP_MAX_MEMBERS];  /**< 成员 */
+    uint8_t  count;                  /**< 成员数 */
+
+    mpu6050_group_select_t select;   /**< 复用器通道选择 (可为NULL) */
+    void    *select_ctx;             /**< 通道选择上下文 */
+    uint8_t  current_channel;        /**< 当前选中的通道 */
+
+    uint32_t nominal_period_us;      /**< 配置的采样周期 (us) */
+    uint32_t period_ns;              /**< 估计的实际采样周期 (ns) */
+    uint32_t start_tick;             /**< FIFO 起点时刻 (get_tick, ms) */
+    uint32_t last_ts_us;             /**< 上一组样本的时间戳 (us) */
+    uint32_t sets;                   /**< FIFO 起点以来输出的样本组数 */
+    uint32_t resync_count;           /**< FIFO 将满后全部成员重新同步的次数 */
+    bool     is_running;             /**< 采集已启动 */
+} mpu6050_group_t;
+
+/* --- 3. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 初始化设备组
+ * @param p_group 设备组指针
+ * @param select 复用器通道选择函数 (无复用器时为NULL)
+ * @param select_ctx 通道选择上下文
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_group_init(mpu6050_group_t *p_group, mpu6050_group_select_t select, void *select_ctx);
+
+/**
+ * @brief 添加成员
+ * @param p_group 设备组指针
+ * @param p_dev 已初始化的设备句柄 (初始化时需已选中其复用器通道)
+ * @param channel 复用器通道 (MPU6050_GROUP_NO_CHANNEL 表示不经过复用器)
+ * @return driver_status_t
+ * @retval DRV_ERR_NO_MEM 成员数已达 MPU6050_GROUP_MAX_MEMBERS
+ * @retval DRV_ERR_BUSY 采集已启动
+ */
+driver_status_t mpu6050_group_add(mpu6050_group_t *p_group, mpu6050_dev_t *p_dev, uint8_t channel);
+
+/**
+ * @brief 选中成员所在的复用器通道 (单独访问某个成员前调用, 如校准或修改配置)
+ * @param p_group 设备组指针
+ * @param index 成员下标
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_group_select(mpu6050_group_t *p_group, uint8_t index);
+
+/**
+ * @brief 启动同步采集
+ * @param p_group 设备组指针
+ * @param sensors 写入 FIFO 的传感器 (MPU6050_FIFO_xxx, 所有成员相同)
+ * @return driver_status_t
+ * @retval DRV_ERR_INVALID_VAL 成员的采样周期或 DLPF 不一致
+ * @retval DRV_ERR_BUSY 某个成员的数据就绪中断或运动唤醒正在使用
+ * @note  本函数只检查, 不写入成员的采样配置: 调用前需以相同的 dlpf_cfg 与 sample_rate_div
+ *        配置所有成员 (mpu6050_init / mpu6050_configure, 带复用器时先 mpu6050_group_select).
+ *        DLPF 不同时即使周期相同, 各成员的群延迟也不同, 同组样本无法对齐.
+ *        先使能所有成员的 FIFO, 再依次清空, 使各 FIFO 的起点尽量接近
+ */
+driver_status_t mpu6050_group_start(mpu6050_group_t *p_group, uint8_t sensors);
+
+/**
+ * @brief 停止同步采集并关闭所有成员的 FIFO
+ * @param p_group 设备组指针
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_group_stop(mpu6050_group_t *p_group);
+
+/**
+ * @brief 读取对齐的样本组
+ * @param p_group 设备组指针
+ * @param p_samples 样本输出 (至少 count * max_sets 个), 按成员分块: 成员 m 的第 k 组位于 p_samples[m * max_sets + k]
+ * @param p_timestamps 每组的时间戳输出 (us, 至少 max_sets 个, 可为NULL);
+ *        get_tick (ms) 换算为 us 后按 32 位取模, 约 71.6 分钟回绕一次,
+ *        比较与求差需使用模运算, 如 (int32_t)(ts_b - ts_a)
+ * @param max_sets 最多读取的样本组数
+ * @param p_sets 实际读取的样本组数
+ * @return driver_status_t
+ * @retval DRV_ERR_NO_MEM 某个成员的 FIFO 将满 (可能已丢失数据), 已清空所有成员重新同步, 本次未读取数据
+ * @note  每个成员每次只需一次计数读取与一次数据读取; 未读出的帧留在 FIFO 中待下次读取
+ */
+driver_status_t mpu6050_group_read(mpu6050_group_t *p_group,
+                                   mpu6050_fifo_sample_t *p_samples,
+                                   uint32_t *p_timestamps,
+                                   uint16_t max_sets,
+                                   uint16_t *p_sets);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MPU6050_GROUP_H_ */
@@ -0,0 +1,1143 @@
+/**
+ * @file mpu6050_spectrum.c
+ * @brief MPU6050 振动频谱分析实现
+ */
+
+#include "mpu6050_spectrum.h"
+#include <string.h>
+#if MPU6050_USE_FLOAT
+#include <math.h>
+#endif
+
+#if MPU6050_USE_FLOAT && MPU6050_SPECTRUM_USE_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#define MPU6050_SPECTRUM_SSE2
+#elif MPU6050_USE_FLOAT && MPU6050_SPECTRUM_USE_SIMD && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define MPU6050_SPECTRUM_NEON
+#endif
+
+/* --- 1. 私有宏定义 (Private Macros) --- */
+
+/*
+ * 旋转因子与窗函数查表: 整圆 MPU6050_SPECTRUM_MAX_POINTS 等分, 表中只存 0 ~ 90 度的正弦 (257 项),
+ * 第 i 等分的角度为 2 * pi * i / MAX_POINTS. N 点实数 FFT 的 W_N^k 对应第 k * (MAX_POINTS / N) 等分.
+ * 旋转因子记为 W = cos - j * sin.
+ */
+#define SPECTRUM_QUARTER         (MPU6050_SPECTRUM_MAX_POINTS / 4)
+#define SPECTRUM_INDEX_MASK      (MPU6050_SPECTRUM_MAX_POINTS - 1)
+
+/*
+ * 块浮点: 输入归一化到 [2^14, 2^15); 每级蝶形前按上一级输出的最大位右移,
+ * 使基-2 输入小于 2^14 (输出增长不超过 2*sqrt(2) 倍), 基-4 输入小于 2^12 (不超过 4*sqrt(2) 倍),
+ * 输出始终在 int16 范围内.
+ */
+#define SPECTRUM_Q_INPUT_BITS    14
+#define SPECTRUM_Q_RADIX2_BITS   14
+#define SPECTRUM_Q_RADIX4_BITS   12
+
+/*
+ * 有效值换算: rms = sqrt(sum |X|^2 * 2 / W2) / N, W2 为窗函数平方的均值 (Hann 3/8, 矩形 1).
+ * 定点增益为 sqrt(2 / W2) * 1000 (mg/g) 的 Q16; 正弦幅值为有效值的 sqrt(2) 倍.
+ */
+#define SPECTRUM_Q_GAIN_HANN     151348909UL
+#define SPECTRUM_Q_GAIN_RECT     92681900UL
+#define SPECTRUM_Q_AMP_HANN      214039680UL
+#define SPECTRUM_Q_AMP_RECT      131072000UL
+#if MPU6050_USE_FLOAT
+#define SPECTRUM_GAIN_HANN       2.309401077f
+#define SPECTRUM_GAIN_RECT       1.414213562f
+#define SPECTRUM_SQRT2           1.414213562f
+#endif
+
+/* 峰值幅值按峰值两侧各 SPECTRUM_PEAK_SPAN 个频点的能量估计 (Hann 窗主瓣宽 +-2 个频点) */
+#define SPECTRUM_PEAK_SPAN       2
+
+/* 峰值频率插值的小数位数 */
+#define SPECTRUM_FRAC_BITS       8
+
+/* sin(k * pi / 512), k = 0 ~ 256, Q15 */
+static const int16_t s_sin_q15[SPECTRUM_QUARTER + 1] = {
+        0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,  2009,  2210,
+     2411,  2611,  2811,  3012,  3212,  3412,  3612,  3812,  4011,  4211,  4410,  4609,
+     4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,  6393,  6590,  6787,  6983,
+     7180,  7376,  7571,  7767,  7962,  8157,  8351,  8546,  8740,  8933,  9127,  9319,
+     9512,  9704,  9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605,
+    11793, 11980, 12167, 12354, 12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828,
+    14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269, 15447, 15624, 15800, 15976,
+    16151, 16326, 16500, 16673, 16846, 17018, 17190, 17361, 17531, 17700, 17869, 18037,
+    18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001,
+    20160, 20318, 20475, 20632, 20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856,
+    22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028, 23170, 23312, 23453, 23593,
+    23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680, 24812, 24943, 25073, 25202,
+    25330, 25457, 25583, 25708, 25833, 25956, 26078, 26199, 26320, 26439, 26557, 26674,
+    26791, 26906, 27020, 27133, 27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002,
+    28106, 28209, 28311, 28411, 28511, 28610, 28707, 28803, 28899, 28993, 29086, 29178,
+    29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038, 30118, 30196,
+    30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784, 30853, 30920, 30986, 31050,
+    31114, 31177, 31238, 31298, 31357, 31415, 31471, 31527, 31581, 31634, 31686, 31737,
+    31786, 31834, 31881, 31927, 31972, 32015, 32058, 32099, 32138, 32177, 32214, 32251,
+    32286, 32319, 32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+    32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738, 32746, 32753,
+    32758, 32762, 32766, 32767, 32767
+};
+
+#if MPU6050_USE_FLOAT
+/* sin(k * pi / 512), k = 0 ~ 256 */
+static const float s_sin_f32[SPECTRUM_QUARTER + 1] = {
+    0.000000000f, 0.006135885f, 0.012271538f, 0.018406730f, 0.024541229f, 0.030674803f,
+    0.036807223f, 0.042938257f, 0.049067674f, 0.055195244f, 0.061320736f, 0.067443920f,
+    0.073564564f, 0.079682438f, 0.085797312f, 0.091908956f, 0.098017140f, 0.104121634f,
+    0.110222207f, 0.116318631f, 0.122410675f, 0.128498111f, 0.134580709f, 0.140658239f,
+    0.146730474f, 0.152797185f, 0.158858143f, 0.164913120f, 0.170961889f, 0.177004220f,
+    0.183039888f, 0.189068664f, 0.195090322f, 0.201104635f, 0.207111376f, 0.213110320f,
+    0.219101240f, 0.225083911f, 0.231058108f, 0.237023606f, 0.242980180f, 0.248927606f,
+    0.254865660f, 0.260794118f, 0.266712757f, 0.272621355f, 0.278519689f, 0.284407537f,
+    0.290284677f, 0.296150888f, 0.302005949f, 0.307849640f, 0.313681740f, 0.319502031f,
+    0.325310292f, 0.331106306f, 0.336889853f, 0.342660717f, 0.348418680f, 0.354163525f,
+    0.359895037f, 0.365612998f, 0.371317194f, 0.377007410f, 0.382683432f, 0.388345047f,
+    0.393992040f, 0.399624200f, 0.405241314f, 0.410843171f, 0.416429560f, 0.422000271f,
+    0.427555093f, 0.433093819f, 0.438616239f, 0.444122145f, 0.449611330f, 0.455083587f,
+    0.460538711f, 0.465976496f, 0.471396737f, 0.476799230f, 0.482183772f, 0.487550160f,
+    0.492898192f, 0.498227667f, 0.503538384f, 0.508830143f, 0.514102744f, 0.519355990f,
+    0.524589683f, 0.529803625f, 0.534997620f, 0.540171473f, 0.545324988f, 0.550457973f,
+    0.555570233f, 0.560661576f, 0.565731811f, 0.570780746f, 0.575808191f, 0.580813958f,
+    0.585797857f, 0.590759702f, 0.595699304f, 0.600616479f, 0.605511041f, 0.610382806f,
+    0.615231591f, 0.620057212f, 0.624859488f, 0.629638239f, 0.634393284f, 0.639124445f,
+    0.643831543f, 0.648514401f, 0.653172843f, 0.657806693f, 0.662415778f, 0.666999922f,
+    0.671558955f, 0.676092704f, 0.680600998f, 0.685083668f, 0.689540545f, 0.693971461f,
+    0.698376249f, 0.702754744f, 0.707106781f, 0.711432196f, 0.715730825f, 0.720002508f,
+    0.724247083f, 0.728464390f, 0.732654272f, 0.736816569f, 0.740951125f, 0.745057785f,
+    0.749136395f, 0.753186799f, 0.757208847f, 0.761202385f, 0.765167266f, 0.769103338f,
+    0.773010453f, 0.776888466f, 0.780737229f, 0.784556597f, 0.788346428f, 0.792106577f,
+    0.795836905f, 0.799537269f, 0.803207531f, 0.806847554f, 0.810457198f, 0.814036330f,
+    0.817584813f, 0.821102515f, 0.824589303f, 0.828045045f, 0.831469612f, 0.834862875f,
+    0.838224706f, 0.841554977f, 0.844853565f, 0.848120345f, 0.851355193f, 0.854557988f,
+    0.857728610f, 0.860866939f, 0.863972856f, 0.867046246f, 0.870086991f, 0.873094978f,
+    0.876070094f, 0.879012226f, 0.881921264f, 0.884797098f, 0.887639620f, 0.890448723f,
+    0.893224301f, 0.895966250f, 0.898674466f, 0.901348847f, 0.903989293f, 0.906595705f,
+    0.909167983f, 0.911706032f, 0.914209756f, 0.916679060f, 0.919113852f, 0.921514039f,
+    0.923879533f, 0.926210242f, 0.928506080f, 0.930766961f, 0.932992799f, 0.935183510f,
+    0.937339012f, 0.939459224f, 0.941544065f, 0.943593458f, 0.945607325f, 0.947585591f,
+    0.949528181f, 0.951435021f, 0.953306040f, 0.955141168f, 0.956940336f, 0.958703475f,
+    0.960430519f, 0.962121404f, 0.963776066f, 0.965394442f, 0.966976471f, 0.968522094f,
+    0.970031253f, 0.971503891f, 0.972939952f, 0.974339383f, 0.975702130f, 0.977028143f,
+    0.978317371f, 0.979569766f, 0.980785280f, 0.981963869f, 0.983105487f, 0.984210092f,
+    0.985277642f, 0.986308097f, 0.987301418f, 0.988257568f, 0.989176510f, 0.990058210f,
+    0.990902635f, 0.991709754f, 0.992479535f, 0.993211949f, 0.993906970f, 0.994564571f,
+    0.995184727f, 0.995767414f, 0.996312612f, 0.996820299f, 0.997290457f, 0.997723067f,
+    0.998118113f, 0.998475581f, 0.998795456f, 0.999077728f, 0.999322385f, 0.999529418f,
+    0.999698819f, 0.999830582f, 0.999924702f, 0.999981175f, 1.000000000f
+};
+#endif
+
+/* --- 2. 私有函数声明 (Private Functions) --- */
+
+static driver_status_t static_param_init(mpu6050_spectrum_param_t *p_param,
+                                         const mpu6050_dev_t *p_dev,
+                                         const mpu6050_spectrum_config_t *p_config);
+static int16_t static_axis_value(const mpu6050_fifo_sample_t *p_sample, uint8_t axis);
+static uint32_t static_isqrt64(uint64_t value);
+static void static_twiddle_q15(uint16_t index, int32_t *p_cos, int32_t *p_sin);
+static uint8_t static_q_headroom(uint32_t bits, uint8_t limit);
+static uint32_t static_q_prepare(mpu6050_spectrum_q_t *p_spec, int32_t *p_exp);
+static void static_q_fft(int16_t *p_buf, uint16_t m, uint32_t bits, int32_t *p_exp);
+static uint32_t static_q_radix2(int16_t *p_buf, uint16_t m, uint8_t shift);
+static uint32_t static_q_radix4(int16_t *p_buf, uint16_t m, uint16_t span, uint8_t shift);
+static uint64_t static_q_bin_power(const int16_t *p_buf, uint16_t m, uint16_t k);
+static uint16_t static_q_rms_mg(const mpu6050_spectrum_param_t *p_param, uint64_t energy,
+                                int32_t exp, uint32_t gain_q16);
+static int32_t static_peak_offset(const mpu6050_spectrum_param_t *p_param,
+                                  uint32_t mag_minus, uint32_t mag_peak, uint32_t mag_plus);
+static uint16_t static_peak_freq_dhz(const mpu6050_spectrum_param_t *p_param, uint16_t k, int32_t offset);
+#if MPU6050_USE_FLOAT
+static void static_twiddle_f32(uint16_t index, float *p_cos, float *p_sin);
+static void static_f32_fft(float *p_buf, uint16_t m);
+static void static_f32_radix4(float *p_buf, uint16_t m, uint16_t span);
+static float static_f32_bin_power(const float *p_buf, uint16_t m, uint16_t k);
+static uint16_t static_f32_to_u16(float value);
+#endif
+
+/* --- 3. 公共函数实现 (Public Functions) --- */
+
+driver_status_t mpu6050_spectrum_q_init(mpu6050_spectrum_q_t *p_spec,
+                                        const mpu6050_dev_t *p_dev,
+                                        const mpu6050_spectrum_config_t *p_config,
+                                        int16_t *p_buf)
+{
+    if (p_spec == NULL || p_buf == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_spec->p_buf = p_buf;
+    return static_param_init(&p_spec->param, p_dev, p_config);
+}
+
+driver_status_t mpu6050_spectrum_q_feed(mpu6050_spectrum_q_t *p_spec,
+                                        const mpu6050_fifo_sample_t *p_samples,
+                                        uint16_t count,
+                                        uint16_t *p_used)
+{
+    mpu6050_spectrum_param_t *p_param;
+    uint16_t used = 0;
+    int16_t value;
+
+    if (p_spec == NULL || !p_spec->param.is_initialized || p_used == NULL ||
+        (p_samples == NULL && count > 0)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_param = &p_spec->param;
+    while (used < count && p_param->fill < p_param->points) {
+        value = static_axis_value(&p_samples[used++], p_param->axis);
+        p_spec->p_buf[p_param->fill++] = value;
+        p_param->sum += value;
+    }
+
+    *p_used = used;
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_spectrum_q_compute(mpu6050_spectrum_q_t *p_spec,
+                                           mpu6050_spectrum_features_t *p_out)
+{
+    mpu6050_spectrum_param_t *p_param;
+    uint64_t band_energy[MPU6050_SPECTRUM_MAX_BANDS];
+    uint64_t total = 0;
+    uint64_t peak_power = 0;
+    uint64_t peak_energy = 0;
+    uint64_t power;
+    uint32_t bits;
+    int32_t exp;
+    int32_t offset;
+    uint16_t m;
+    uint16_t k;
+    uint16_t peak_k = 0;
+    uint8_t band = 0;
+    bool is_hann;
+
+    if (p_spec == NULL || !p_spec->param.is_initialized || p_out == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_param = &p_spec->param;
+    if (p_param->fill < p_param->points) {
+        return DRV_ERR_BUSY;
+    }
+
+    memset(p_out, 0, sizeof(mpu6050_spectrum_features_t));
+    memset(band_energy, 0, sizeof(band_energy));
+    p_out->band_count = p_param->band_count;
+    m = p_param->points / 2;
+
+    bits = static_q_prepare(p_spec, &exp);
+    p_param->fill = 0;
+    p_param->sum = 0;
+    if (bits == 0) {
+        return DRV_OK;   /* 数据块为常数, 没有振动分量 */
+    }
+
+    static_q_fft(p_spec->p_buf, m, bits, &exp);
+
+    /* 逐频点计算功率, 同时累加频带能量并查找峰值 (不含直流) */
+    for (k = 1; k < m; k++) {
+        power = static_q_bin_power(p_spec->p_buf, m, k);
+        total += power;
+        if (power > peak_power) {
+            peak_power = power;
+            peak_k = k;
+        }
+        while (band < p_param->band_count && k >= p_param->band_bin[band + 1]) {
+            band++;
+        }
+        if (band < p_param->band_count && k >= p_param->band_bin[band]) {
+            band_energy[band] += power;
+        }
+    }
+
+    is_hann = (p_param->window == MPU6050_SPECTRUM_WINDOW_HANN);
+    for (band = 0; band < p_param->band_count; band++) {
+        p_out->band_rms_mg[band] = static_q_rms_mg(p_param, band_energy[band], exp,
+                                                   is_hann ? SPECTRUM_Q_GAIN_HANN : SPECTRUM_Q_GAIN_RECT);
+    }
+    p_out->rms_mg = static_q_rms_mg(p_param, total, exp,
+                                    is_hann ? SPECTRUM_Q_GAIN_HANN : SPECTRUM_Q_GAIN_RECT);
+
+    if (peak_power > 0) {
+        offset = static_peak_offset(p_param,
+                                    static_isqrt64(static_q_bin_power(p_spec->p_buf, m, peak_k - 1)),
+                                    static_isqrt64(peak_power),
+                                    static_isqrt64(static_q_bin_power(p_spec->p_buf, m, peak_k + 1)));
+        p_out->peak_freq_dhz = static_peak_freq_dhz(p_param, peak_k, offset);
+
+        for (k = (peak_k > SPECTRUM_PEAK_SPAN) ? (uint16_t)(peak_k - SPECTRUM_PEAK_SPAN) : 1;
+             k <= peak_k + SPECTRUM_PEAK_SPAN && k < m; k++) {
+            peak_energy += static_q_bin_power(p_spec->p_buf, m, k);
+        }
+        p_out->peak_amp_mg = static_q_rms_mg(p_param, peak_energy, exp,
+                                             is_hann ? SPECTRUM_Q_AMP_HANN : SPECTRUM_Q_AMP_RECT);
+    }
+
+    return DRV_OK;
+}
+
+#if MPU6050_USE_FLOAT
+driver_status_t mpu6050_spectrum_init(mpu6050_spectrum_t *p_spec,
+                                      const mpu6050_dev_t *p_dev,
+                                      const mpu6050_spectrum_config_t *p_config,
+                                      float *p_buf)
+{
+    if (p_spec == NULL || p_buf == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_spec->p_buf = p_buf;
+    return static_param_init(&p_spec->param, p_dev, p_config);
+}
+
+driver_status_t mpu6050_spectrum_feed(mpu6050_spectrum_t *p_spec,
+                                      const mpu6050_fifo_sample_t *p_samples,
+                                      uint16_t count,
+                                      uint16_t *p_used)
+{
+    mpu6050_spectrum_param_t *p_param;
+    uint16_t used = 0;
+    int16_t value;
+
+    if (p_spec == NULL || !p_spec->param.is_initialized || p_used == NULL ||
+        (p_samples == NULL && count > 0)) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_param = &p_spec->param;
+    while (used < count && p_param->fill < p_param->points) {
+        value = static_axis_value(&p_samples[used++], p_param->axis);
+        p_spec->p_buf[p_param->fill++] = (float)value;
+        p_param->sum += value;
+    }
+
+    *p_used = used;
+    return DRV_OK;
+}
+
+driver_status_t mpu6050_spectrum_compute(mpu6050_spectrum_t *p_spec,
+                                         mpu6050_spectrum_features_t *p_out)
+{
+    mpu6050_spectrum_param_t *p_param;
+    float band_energy[MPU6050_SPECTRUM_MAX_BANDS];
+    float total = 0.0f;
+    float peak_power = 0.0f;
+    float peak_energy = 0.0f;
+    float power;
+    float mean;
+    float scale;
+    float gain;
+    float c;
+    float s;
+    int32_t offset;
+    uint16_t n;
+    uint16_t m;
+    uint16_t k;
+    uint16_t step;
+    uint16_t peak_k = 0;
+    uint8_t band = 0;
+
+    if (p_spec == NULL || !p_spec->param.is_initialized || p_out == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    p_param = &p_spec->param;
+    if (p_param->fill < p_param->points) {
+        return DRV_ERR_BUSY;
+    }
+
+    memset(p_out, 0, sizeof(mpu6050_spectrum_features_t));
+    memset(band_energy, 0, sizeof(band_energy));
+    p_out->band_count = p_param->band_count;
+    n = p_param->points;
+    m = n / 2;
+
+    /* 去直流, 换算为 mg 并加窗 */
+    mean = (float)p_param->sum / (float)n;
+    scale = 1000.0f / (float)p_param->accel_sensitivity;
+    step = MPU6050_SPECTRUM_MAX_POINTS / n;
+    for (k = 0; k < n; k++) {
+        p_spec->p_buf[k] = (p_spec->p_buf[k] - mean) * scale;
+        if (p_param->window == MPU6050_SPECTRUM_WINDOW_HANN) {
+            static_twiddle_f32((uint16_t)(k * step), &c, &s);
+            p_spec->p_buf[k] *= 0.5f - 0.5f * c;
+        }
+    }
+    p_param->fill = 0;
+    p_param->sum = 0;
+
+    static_f32_fft(p_spec->p_buf, m);
+
+    for (k = 1; k < m; k++) {
+        power = static_f32_bin_power(p_spec->p_buf, m, k);
+        total += power;
+        if (power > peak_power) {
+            peak_power = power;
+            peak_k = k;
+        }
+        while (band < p_param->band_count && k >= p_param->band_bin[band + 1]) {
+            band++;
+        }
+        if (band < p_param->band_count && k >= p_param->band_bin[band]) {
+            band_energy[band] += power;
+        }
+    }
+
+    gain = ((p_param->window == MPU6050_SPECTRUM_WINDOW_HANN) ? SPECTRUM_GAIN_HANN : SPECTRUM_GAIN_RECT) / (float)n;
+    for (band = 0; band < p_param->band_count; band++) {
+        p_out->band_rms_mg[band] = static_f32_to_u16(sqrtf(band_energy[band]) * gain);
+    }
+    p_out->rms_mg = static_f32_to_u16(sqrtf(total) * gain);
+
+    if (peak_power > 0.0f) {
+        offset = static_peak_offset(p_param,
+                                    (uint32_t)(sqrtf(static_f32_bin_power(p_spec->p_buf, m, peak_k - 1)) * 65536.0f / sqrtf(peak_power)),
+                                    65536UL,
+                                    (uint32_t)(sqrtf(static_f32_bin_power(p_spec->p_buf, m, peak_k + 1)) * 65536.0f / sqrtf(peak_power)));
+        p_out->peak_freq_dhz = static_peak_freq_dhz(p_param, peak_k, offset);
+
+        for (k = (peak_k > SPECTRUM_PEAK_SPAN) ? (uint16_t)(peak_k - SPECTRUM_PEAK_SPAN) : 1;
+             k <= peak_k + SPECTRUM_PEAK_SPAN && k < m; k++) {
+            peak_energy += static_f32_bin_power(p_spec->p_buf, m, k);
+        }
+        p_out->peak_amp_mg = static_f32_to_u16(sqrtf(peak_energy) * gain * SPECTRUM_SQRT2);
+    }
+
+    return DRV_OK;
+}
+#endif /* MPU6050_USE_FLOAT */
+
+/* --- 4. 私有函数实现 (Private Functions) --- */
+
+static driver_status_t static_param_init(mpu6050_spectrum_param_t *p_param,
+                                         const mpu6050_dev_t *p_dev,
+                                         const mpu6050_spectrum_config_t *p_config)
+{
+    uint32_t period_us;
+    uint64_t bin;
+    uint8_t i;
+
+    if (p_dev == NULL || !p_dev->is_initialized || p_config == NULL) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    if (p_config->points < MPU6050_SPECTRUM_MIN_POINTS || p_config->points > MPU6050_SPECTRUM_MAX_POINTS ||
+        (p_config->points & (p_config->points - 1)) != 0 ||
+        p_config->axis > MPU6050_SPECTRUM_AXIS_Z || p_config->window > MPU6050_SPECTRUM_WINDOW_HANN ||
+        p_config->band_count > MPU6050_SPECTRUM_MAX_BANDS) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    for (i = 0; i < p_config->band_count; i++) {
+        if (p_config->band_edges_hz[i] >= p_config->band_edges_hz[i + 1]) {
+            return DRV_ERR_INVALID_VAL;
+        }
+    }
+
+    period_us = mpu6050_get_sample_period_us(p_dev);
+    if (period_us == 0 || p_dev->accel_sensitivity == 0) {
+        return DRV_ERR_INVALID_VAL;
+    }
+
+    memset(p_param, 0, sizeof(mpu6050_spectrum_param_t));
+    p_param->points = p_config->points;
+    p_param->axis = (uint8_t)p_config->axis;
+    p_param->window = (uint8_t)p_config->window;
+    p_param->band_count = p_config->band_count;
+    p_param->accel_sensitivity = p_dev->accel_sensitivity;
+
+    /* fs / N = 1e6 / (period_us * N) Hz */
+    p_param->bin_dhz_q16 = (uint32_t)((10000000ULL << 16) / ((uint64_t)period_us * p_config->points));
+
+    /* 边界频率对应的频点 (四舍五入), 不含直流, 不超过 N/2 */
+    for (i = 0; i <= p_config->band_count && p_config->band_count > 0; i++) {
+        bin = ((uint64_t)p_config->band_edges_hz[i] * p_config->points * period_us + 500000) / 1000000;
+        if (bin < 1) {
+            bin = 1;
+        }
+        if (bin > p_config->points / 2) {
+            bin = p_config->points / 2;
+        }
+        p_param->band_bin[i] = (uint16_t)bin;
+    }
+
+    p_param->is_initialized = true;
+    return DRV_OK;
+}
+
+static int16_t static_axis_value(const mpu6050_fifo_sample_t *p_sample, uint8_t axis)
+{
+    if (axis == MPU6050_SPECTRUM_AXIS_X) {
+        return p_sample->accel.x;
+    }
+    if (axis == MPU6050_SPECTRUM_AXIS_Y) {
+        return p_sample->accel.y;
+    }
+    return p_sample->accel.z;
+}
+
+static uint32_t static_isqrt64(uint64_t value)
+{
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)result;
+}
+
+static void static_twiddle_q15(uint16_t index, int32_t *p_cos, int32_t *p_sin)
+{
+    uint16_t r = index & (SPECTRUM_QUARTER - 1);
+
+    switch ((index & SPECTRUM_INDEX_MASK) / SPECTRUM_QUARTER) {
+    case 0:
+        *p_sin = s_sin_q15[r];
+        *p_cos = s_sin_q15[SPECTRUM_QUARTER - r];
+        break;
+    case 1:
+        *p_sin = s_sin_q15[SPECTRUM_QUARTER - r];
+        *p_cos = -s_sin_q15[r];
+        break;
+    case 2:
+        *p_sin = -s_sin_q15[r];
+        *p_cos = -s_sin_q15[SPECTRUM_QUARTER - r];
+        break;
+    default:
+        *p_sin = -s_sin_q15[SPECTRUM_QUARTER - r];
+        *p_cos = s_sin_q15[r];
+        break;
+    }
+}
+
+/**
+ * @brief 右移位数, 使 bits 的最高位低于 limit
+ */
+static uint8_t static_q_headroom(uint32_t bits, uint8_t limit)
+{
+    uint8_t shift = 0;
+
+    while ((bits >> shift) >= (1UL << limit)) {
+        shift++;
+    }
+
+    return shift;
+}
+
+/**
+ * @brief 去直流, 归一化并加窗 (原地)
+ * @param p_exp 输出: 缓冲数据 = 原始值 * 窗 * 2^exp
+ * @return 所有数据绝对值的按位或 (0 表示数据块为常数)
+ */
+static uint32_t static_q_prepare(mpu6050_spectrum_q_t *p_spec, int32_t *p_exp)
+{
+    const mpu6050_spectrum_param_t *p_param = &p_spec->param;
+    int16_t *p_buf = p_spec->p_buf;
+    uint16_t n = p_param->points;
+    uint16_t step = MPU6050_SPECTRUM_MAX_POINTS / n;
+    int32_t mean;
+    int32_t value;
+    int32_t c;
+    int32_t s;
+    uint32_t bits = 0;
+    int32_t exp = 0;
+    uint16_t i;
+
+    mean = (p_param->sum >= 0) ? (p_param->sum + n / 2) / n : (p_param->sum - n / 2) / n;
+    for (i = 0; i < n; i++) {
+        value = p_buf[i] - mean;
+        bits |= (uint32_t)((value < 0) ? -value : value);
+    }
+    if (bits == 0) {
+        return 0;
+    }
+
+    /* 归一化到 [2^14, 2^15) */
+    while ((bits >> -exp) >= (1UL << (SPECTRUM_Q_INPUT_BITS + 1))) {
+        exp--;
+    }
+    while (exp >= 0 && (bits << exp) < (1UL << SPECTRUM_Q_INPUT_BITS)) {
+        exp++;
+    }
+
+    bits = 0;
+    for (i = 0; i < n; i++) {
+        value = p_buf[i] - mean;
+        value = (exp >= 0) ? value * (1L << exp) : (value >> -exp);
+        if (p_param->window == MPU6050_SPECTRUM_WINDOW_HANN) {
+            /* w = (1 - cos) / 2, Q15 */
+            static_twiddle_q15((uint16_t)(i * step), &c, &s);
+            value = (value * ((32768 - c) >> 1) + 0x4000) >> 15;
+        }
+        p_buf[i] = (int16_t)value;
+        bits |= (uint32_t)((value < 0) ? -value : value);
+    }
+
+    *p_exp = exp;
+    return bits;
+}
+
+/**
+ * @brief m 点复数 FFT (原地, 数据按 实部/虚部 交错存放)
+ * @param bits 输入数据绝对值的按位或
+ * @param p_exp 每级右移后减去对应位数
+ */
+static void static_q_fft(int16_t *p_buf, uint16_t m, uint32_t bits, int32_t *p_exp)
+{
+    uint16_t span = 1;
+    uint16_t i;
+    uint16_t j = 0;
+    uint16_t bit;
+    uint8_t shift;
+    int16_t tmp;
+
+    /* 位反转重排 */
+    for (i = 0; i < m - 1; i++) {
+        if (i < j) {
+            tmp = p_buf[2 * i];
+            p_buf[2 * i] = p_buf[2 * j];
+            p_buf[2 * j] = tmp;
+            tmp = p_buf[2 * i + 1];
+            p_buf[2 * i + 1] = p_buf[2 * j + 1];
+            p_buf[2 * j + 1] = tmp;
+        }
+        bit = m >> 1;
+        while (j & bit) {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+
+    /* log2(m) 为奇数时先做一级基-2 */
+    for (bit = m; bit > 1; bit >>= 2) {
+        if (bit == 2) {
+            shift = static_q_headroom(bits, SPECTRUM_Q_RADIX2_BITS);
+            bits = static_q_radix2(p_buf, m, shift);
+            *p_exp -= shift;
+            span = 2;
+        }
+    }
+
+    for (; span < m; span *= 4) {
+        shift = static_q_headroom(bits, SPECTRUM_Q_RADIX4_BITS);
+        bits = static_q_radix4(p_buf, m, span, shift);
+        *p_exp -= shift;
+    }
+}
+
+static uint32_t static_q_radix2(int16_t *p_buf, uint16_t m, uint8_t shift)
+{
+    uint32_t bits = 0;
+    int32_t ar, ai, br, bi;
+    int32_t v;
+    uint16_t i;
+
+    for (i = 0; i < m; i += 2) {
+        ar = p_buf[2 * i] >> shift;
+        ai = p_buf[2 * i + 1] >> shift;
+        br = p_buf[2 * i + 2] >> shift;
+        bi = p_buf[2 * i + 3] >> shift;
+
+        v = ar + br; p_buf[2 * i] = (int16_t)v;     bits |= (uint32_t)((v < 0) ? -v : v);
+        v = ai + bi; p_buf[2 * i + 1] = (int16_t)v; bits |= (uint32_t)((v < 0) ? -v : v);
+        v = ar - br; p_buf[2 * i + 2] = (int16_t)v; bits |= (uint32_t)((v < 0) ? -v : v);
+        v = ai - bi; p_buf[2 * i + 3] = (int16_t)v; bits |= (uint32_t)((v < 0) ? -v : v);
+    }
+
+    return bits;
+}
+
+/**
+ * @brief 一级基-4 蝶形 (位反转输入, 跨度 span, 组长 4 * span)
+ * @note  输入 x0 ~ x3 位于 g, g + span, g + 2 * span, g + 3 * span; 以 W = W_{4span}:
+ *        b0 = x0, b1 = W^j * x2, b2 = W^2j * x1, b3 = W^3j * x3,
+ *        y0 = b0 + b2 + b1 + b3, y1 = b0 - b2 - j(b1 - b3), y2 = b0 + b2 - b1 - b3, y3 = b0 - b2 + j(b1 - b3)
+ */
+static uint32_t static_q_radix4(int16_t *p_buf, uint16_t m, uint16_t span, uint8_t shift)
+{
+    uint16_t step = (uint16_t)(MPU6050_SPECTRUM_MAX_POINTS / (4 * span));
+    uint32_t bits = 0;
+    int32_t c1, s1, c2, s2, c3, s3;
+    int32_t xr, xi;
+    int32_t b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i;
+    int32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+    int32_t v;
+    int16_t *p;
+    uint16_t j;
+    uint16_t g;
+
+    for (j = 0; j < span; j++) {
+        static_twiddle_q15((uint16_t)(j * step), &c1, &s1);
+        static_twiddle_q15((uint16_t)(2 * j * step), &c2, &s2);
+        static_twiddle_q15((uint16_t)(3 * j * step), &c3, &s3);
+
+        for (g = j; g < m; g += 4 * span) {
+            p = &p_buf[2 * g];
+
+            b0r = p[0] >> shift;
+            b0i = p[1] >> shift;
+
+            /* (xr + j*xi)(c - j*s) = xr*c + xi*s + j(xi*c - xr*s) */
+            xr = p[4 * span] >> shift;
+            xi = p[4 * span + 1] >> shift;
+            b1r = (xr * c1 + xi * s1 + 0x4000) >> 15;
+            b1i = (xi * c1 - xr * s1 + 0x4000) >> 15;
+
+            xr = p[2 * span] >> shift;
+            xi = p[2 * span + 1] >> shift;
+            b2r = (xr * c2 + xi * s2 + 0x4000) >> 15;
+            b2i = (xi * c2 - xr * s2 + 0x4000) >> 15;
+
+            xr = p[6 * span] >> shift;
+            xi = p[6 * span + 1] >> shift;
+            b3r = (xr * c3 + xi * s3 + 0x4000) >> 15;
+            b3i = (xi * c3 - xr * s3 + 0x4000) >> 15;
+
+            t0r = b0r + b2r; t0i = b0i + b2i;
+            t1r = b0r - b2r; t1i = b0i - b2i;
+            t2r = b1r + b3r; t2i = b1i + b3i;
+            t3r = b1r - b3r; t3i = b1i - b3i;
+
+            /* -j * t3 = t3i - j * t3r */
+            v = t0r + t2r; p[0] = (int16_t)v;            bits |= (uint32_t)((v < 0) ? -v : v);
+            v = t0i + t2i; p[1] = (int16_t)v;            bits |= (uint32_t)((v < 0) ? -v : v);
+            v = t1r + t3i; p[2 * span] = (int16_t)v;     bits |= (uint32_t)((v < 0) ? -v : v);
+            v = t1i - t3r; p[2 * span + 1] = (int16_t)v; bits |= (uint32_t)((v < 0) ? -v : v);
+            v = t0r - t2r; p[4 * span] = (int16_t)v;     bits |= (uint32_t)((v < 0) ? -v : v);
+            v = t0i - t2i; p[4 * span + 1] = (int16_t)v; bits |= (uint32_t)((v < 0) ? -v : v);
+            v = t1r - t3i; p[6 * span] = (int16_t)v;     bits |= (uint32_t)((v < 0) ? -v : v);
+            v = t1i + t3r; p[6 * span + 1] = (int16_t)v; bits |= (uint32_t)((v < 0) ? -v : v);
+        }
+    }
+
+    return bits;
+}
+
+/**
+ * @brief 由 m 点复数 FFT 结果 Z 分离出实数 FFT 的第 k 个频点 (0 <= k <= m), 返回 |2X[k]|^2
+ * @note  A = Z[k], B = conj(Z[m - k]): 2X[k] = (A + B) + W_N^k * (-j)(A - B)
+ */
+static uint64_t static_q_bin_power(const int16_t *p_buf, uint16_t m, uint16_t k)
+{
+    uint16_t mk = (uint16_t)((m - k) & (m - 1));
+    int32_t ar, ai, br, bi;
+    int32_t dr, di;
+    int32_t c, s;
+    int32_t xr, xi;
+
+    if (k == m) {
+        xr = 2 * ((int32_t)p_buf[0] - p_buf[1]);
+        return (uint64_t)((int64_t)xr * xr);
+    }
+
+    ar = p_buf[2 * k];
+    ai = p_buf[2 * k + 1];
+    br = p_buf[2 * mk];
+    bi = -p_buf[2 * mk + 1];
+    dr = ar - br;
+    di = ai - bi;
+
+    /* (-j)(A - B) = di - j * dr */
+    static_twiddle_q15((uint16_t)(k * (MPU6050_SPECTRUM_MAX_POINTS / (2 * m))), &c, &s);
+    xr = ar + br + (int32_t)(((int64_t)c * di - (int64_t)s * dr + 0x4000) >> 15);
+    xi = ai + bi + (int32_t)(((int64_t)-c * dr - (int64_t)s * di + 0x4000) >> 15);
+
+    return (uint64_t)((int64_t)xr * xr + (int64_t)xi * xi);
+}
+
+/**
+ * @brief 频点能量和 (|2X|^2 * 2^(2 * exp)) 换算为有效值 (mg)
+ * @note  rms_mg = sqrt(energy) * gain / 2^16 / 2^(exp + 1) / (N * sensitivity)
+ */
+static uint16_t static_q_rms_mg(const mpu6050_spectrum_param_t *p_param, uint64_t energy,
+                                int32_t exp, uint32_t gain_q16)
+{
+    uint64_t num = (uint64_t)static_isqrt64(energy) * gain_q16;
+    uint64_t den = (uint64_t)p_param->points * p_param->accel_sensitivity;
+    int32_t shift = 16 + exp + 1;
+    uint64_t result;
+
+    if (shift >= 0) {
+        den <<= shift;
+    } else {
+        num <<= -shift;
+    }
+
+    result = (num + den / 2) / den;
+    return (result > 0xFFFF) ? 0xFFFF : (uint16_t)result;
+}
+
+/**
+ * @brief 峰值相对峰值频点的偏移 (频点, Q8, -0.5 ~ 0.5)
+ * @note  Hann 窗: d = 2(m+ - m-) / (m- + 2m0 + m+), 单频信号时无偏;
+ *        矩形窗: d = m+ / (m0 + m+) 或 -m- / (m0 + m-), 取相邻较大的一侧
+ */
+static int32_t static_peak_offset(const mpu6050_spectrum_param_t *p_param,
+                                  uint32_t mag_minus, uint32_t mag_peak, uint32_t mag_plus)
+{
+    int64_t num;
+    int64_t den;
+    int32_t offset;
+
+    if (p_param->window == MPU6050_SPECTRUM_WINDOW_HANN) {
+        num = 2 * ((int64_t)mag_plus - mag_minus);
+        den = (int64_t)mag_minus + 2 * (int64_t)mag_peak + mag_plus;
+    } else if (mag_plus >= mag_minus) {
+        num = mag_plus;
+        den = (int64_t)mag_peak + mag_plus;
+    } else {
+        num = -(int64_t)mag_minus;
+        den = (int64_t)mag_peak + mag_minus;
+    }
+
+    if (den == 0) {
+        return 0;
+    }
+
+    offset = (int32_t)((num << SPECTRUM_FRAC_BITS) / den);
+    if (offset > (1 << (SPECTRUM_FRAC_BITS - 1))) {
+        offset = 1 << (SPECTRUM_FRAC_BITS - 1);
+    } else if (offset < -(1 << (SPECTRUM_FRAC_BITS - 1))) {
+        offset = -(1 << (SPECTRUM_FRAC_BITS - 1));
+    }
+
+    return offset;
+}
+
+static uint16_t static_peak_freq_dhz(const mpu6050_spectrum_param_t *p_param, uint16_t k, int32_t offset)
+{
+    uint64_t bin_q8 = (uint64_t)(((int32_t)k << SPECTRUM_FRAC_BITS) + offset);
+    uint64_t dhz = (bin_q8 * p_param->bin_dhz_q16 + (1ULL << (15 + SPECTRUM_FRAC_BITS))) >> (16 + SPECTRUM_FRAC_BITS);
+
+    return (dhz > 0xFFFF) ? 0xFFFF : (uint16_t)dhz;
+}
+
+#if MPU6050_USE_FLOAT
+static void static_twiddle_f32(uint16_t index, float *p_cos, float *p_sin)
+{
+    uint16_t r = index & (SPECTRUM_QUARTER - 1);
+
+    switch ((index & SPECTRUM_INDEX_MASK) / SPECTRUM_QUARTER) {
+    case 0:
+        *p_sin = s_sin_f32[r];
+        *p_cos = s_sin_f32[SPECTRUM_QUARTER - r];
+        break;
+    case 1:
+        *p_sin = s_sin_f32[SPECTRUM_QUARTER - r];
+        *p_cos = -s_sin_f32[r];
+        break;
+    case 2:
+        *p_sin = -s_sin_f32[r];
+        *p_cos = -s_sin_f32[SPECTRUM_QUARTER - r];
+        break;
+    default:
+        *p_sin = -s_sin_f32[SPECTRUM_QUARTER - r];
+        *p_cos = s_sin_f32[r];
+        break;
+    }
+}
+
+/**
+ * @brief m 点复数 FFT (原地, 数据按 实部/虚部 交错存放), 与定点版本的蝶形顺序相同
+ */
+static void static_f32_fft(float *p_buf, uint16_t m)
+{
+    uint16_t span = 1;
+    uint16_t i;
+    uint16_t j = 0;
+    uint16_t bit;
+    float ar, ai;
+    float tmp;
+
+    for (i = 0; i < m - 1; i++) {
+        if (i < j) {
+            tmp = p_buf[2 * i];
+            p_buf[2 * i] = p_buf[2 * j];
+            p_buf[2 * j] = tmp;
+            tmp = p_buf[2 * i + 1];
+            p_buf[2 * i + 1] = p_buf[2 * j + 1];
+            p_buf[2 * j + 1] = tmp;
+        }
+        bit = m >> 1;
+        while (j & bit) {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+
+    for (bit = m; bit > 1; bit >>= 2) {
+        if (bit == 2) {
+            for (i = 0; i < m; i += 2) {
+                ar = p_buf[2 * i];
+                ai = p_buf[2 * i + 1];
+                p_buf[2 * i] = ar + p_buf[2 * i + 2];
+                p_buf[2 * i + 1] = ai + p_buf[2 * i + 3];
+                p_buf[2 * i + 2] = ar - p_buf[2 * i + 2];
+                p_buf[2 * i + 3] = ai - p_buf[2 * i + 3];
+            }
+            span = 2;
+        }
+    }
+
+    for (; span < m; span *= 4) {
+        static_f32_radix4(p_buf, m, span);
+    }
+}
+
+#if defined(MPU6050_SPECTRUM_SSE2)
+
+/* 2个交错复数与2个旋转因子 (W = c - j*s) 相乘: wr = {c0, c0, c1, c1}, wi = {-s0, -s0, -s1, -s1} */
+static inline __m128 static_sse_cmul(__m128 x, __m128 wr, __m128 wi)
+{
+    const __m128 sign = _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+    __m128 swapped = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+
+    return _mm_add_ps(_mm_mul_ps(x, wr), _mm_mul_ps(_mm_mul_ps(swapped, wi), sign));
+}
+
+static void static_f32_radix4(float *p_buf, uint16_t m, uint16_t span)
+{
+    const __m128 sign = _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f);
+    uint16_t step = (uint16_t)(MPU6050_SPECTRUM_MAX_POINTS / (4 * span));
+    __m128 wr1, wi1, wr2, wi2, wr3, wi3;
+    __m128 b0, b1, b2, b3;
+    __m128 t0, t1, t2, t3;
+    float c[2], s[2];
+    float *p;
+    uint16_t j;
+    uint16_t g;
+    uint8_t k;
+
+    if (span < 2) {
+        /* 第一级 (span = 1) 旋转因子均为1, 2个蝶形分属不同的组, 使用标量实现 */
+        for (g = 0; g < m; g += 4) {
+            p = &p_buf[2 * g];
+            t0 = _mm_setr_ps(p[0] + p[2], p[1] + p[3], p[0] - p[2], p[1] - p[3]);
+            t1 = _mm_setr_ps(p[4] + p[6], p[5] + p[7], p[5] - p[7], p[6] - p[4]);
+            _mm_storeu_ps(p, _mm_add_ps(t0, t1));
+            _mm_storeu_ps(p + 4, _mm_sub_ps(t0, t1));
+        }
+        return;
+    }
+
+    for (j = 0; j < span; j += 2) {
+        for (k = 0; k < 2; k++) {
+            static_twiddle_f32((uint16_t)((j + k) * step), &c[k], &s[k]);
+        }
+        wr1 = _mm_setr_ps(c[0], c[0], c[1], c[1]);
+        wi1 = _mm_setr_ps(-s[0], -s[0], -s[1], -s[1]);
+        for (k = 0; k < 2; k++) {
+            static_twiddle_f32((uint16_t)(2 * (j + k) * step), &c[k], &s[k]);
+        }
+        wr2 = _mm_setr_ps(c[0], c[0], c[1], c[1]);
+        wi2 = _mm_setr_ps(-s[0], -s[0], -s[1], -s[1]);
+        for (k = 0; k < 2; k++) {
+            static_twiddle_f32((uint16_t)(3 * (j + k) * step), &c[k], &s[k]);
+        }
+        wr3 = _mm_setr_ps(c[0], c[0], c[1], c[1]);
+        wi3 = _mm_setr_ps(-s[0], -s[0], -s[1], -s[1]);
+
+        for (g = j; g < m; g += 4 * span) {
+            p = &p_buf[2 * g];
+            b0 = _mm_loadu_ps(p);
+            b1 = static_sse_cmul(_mm_loadu_ps(p + 4 * span), wr1, wi1);
+            b2 = static_sse_cmul(_mm_loadu_ps(p + 2 * span), wr2, wi2);
+            b3 = static_sse_cmul(_mm_loadu_ps(p + 6 * span), wr3, wi3);
+
+            t0 = _mm_add_ps(b0, b2);
+            t1 = _mm_sub_ps(b0, b2);
+            t2 = _mm_add_ps(b1, b3);
+            t3 = _mm_sub_ps(b1, b3);
+            /* -j * t3 = {t3i, -t3r} */
+            t3 = _mm_mul_ps(_mm_shuffle_ps(t3, t3, _MM_SHUFFLE(2, 3, 0, 1)), sign);
+
+            _mm_storeu_ps(p, _mm_add_ps(t0, t2));
+            _mm_storeu_ps(p + 2 * span, _mm_add_ps(t1, t3));
+            _mm_storeu_ps(p + 4 * span, _mm_sub_ps(t0, t2));
+            _mm_storeu_ps(p + 6 * span, _mm_sub_ps(t1, t3));
+        }
+    }
+}
+
+#elif defined(MPU6050_SPECTRUM_NEON)
+
+/* 2个交错复数与2个旋转因子 (W = c - j*s) 相乘: wr = {c0, c0, c1, c1}, wi = {-s0, -s0, -s1, -s1} */
+static inline float32x4_t static_neon_cmul(float32x4_t x, float32x4_t wr, float32x4_t wi, float32x4_t sign)
+{
+    return vmlaq_f32(vmulq_f32(x, wr), vmulq_f32(vrev64q_f32(x), wi), sign);
+}
+
+static void static_f32_radix4(float *p_buf, uint16_t m, uint16_t span)
+{
+    static const float s_cmul_sign[4] = { -1.0f, 1.0f, -1.0f, 1.0f };
+    static const float s_rot_sign[4] = { 1.0f, -1.0f, 1.0f, -1.0f };
+    const float32x4_t cmul_sign = vld1q_f32(s_cmul_sign);
+    const float32x4_t rot_sign = vld1q_f32(s_rot_sign);
+    uint16_t step = (uint16_t)(MPU6050_SPECTRUM_MAX_POINTS / (4 * span));
+    float32x4_t wr[3], wi[3];
+    float32x4_t b0, b1, b2, b3;
+    float32x4_t t0, t1, t2, t3;
+    float c[2], s[2];
+    float lane_r[4], lane_i[4];
+    float *p;
+    uint16_t j;
+    uint16_t g;
+    uint8_t n;
+    uint8_t k;
+
+    if (span < 2) {
+        for (g = 0; g < m; g += 4) {
+            p = &p_buf[2 * g];
+            lane_r[0] = p[0] + p[2]; lane_r[1] = p[1] + p[3]; lane_r[2] = p[0] - p[2]; lane_r[3] = p[1] - p[3];
+            lane_i[0] = p[4] + p[6]; lane_i[1] = p[5] + p[7]; lane_i[2] = p[5] - p[7]; lane_i[3] = p[6] - p[4];
+            t0 = vld1q_f32(lane_r);
+            t1 = vld1q_f32(lane_i);
+            vst1q_f32(p, vaddq_f32(t0, t1));
+            vst1q_f32(p + 4, vsubq_f32(t0, t1));
+        }
+        return;
+    }
+
+    for (j = 0; j < span; j += 2) {
+        for (n = 0; n < 3; n++) {
+            for (k = 0; k < 2; k++) {
+                static_twiddle_f32((uint16_t)((n + 1) * (j + k) * step), &c[k], &s[k]);
+                lane_r[2 * k] = lane_r[2 * k + 1] = c[k];
+                lane_i[2 * k] = lane_i[2 * k + 1] = -s[k];
+            }
+            wr[n] = vld1q_f32(lane_r);
+            wi[n] = vld1q_f32(lane_i);
+        }
+
+        for (g = j; g < m; g += 4 * span) {
+            p = &p_buf[2 * g];
+            b0 = vld1q_f32(p);
+            b1 = static_neon_cmul(vld1q_f32(p + 4 * span), wr[0], wi[0], cmul_sign);
+            b2 = static_neon_cmul(vld1q_f32(p + 2 * span), wr[1], wi[1], cmul_sign);
+            b3 = static_neon_cmul(vld1q_f32(p + 6 * span), wr[2], wi[2], cmul_sign);
+
+            t0 = vaddq_f32(b0, b2);
+            t1 = vsubq_f32(b0, b2);
+            t2 = vaddq_f32(b1, b3);
+            t3 = vmulq_f32(vrev64q_f32(vsubq_f32(b1, b3)), rot_sign);
+
+            vst1q_f32(p, vaddq_f32(t0, t2));
+            vst1q_f32(p + 2 * span, vaddq_f32(t1, t3));
+            vst1q_f32(p + 4 * span, vsubq_f32(t0, t2));
+            vst1q_f32(p + 6 * span, vsubq_f32(t1, t3));
+        }
+    }
+}
+
+#else
+
+static void static_f32_radix4(float *p_buf, uint16_t m, uint16_t span)
+{
+    uint16_t step = (uint16_t)(MPU6050_SPECTRUM_MAX_POINTS / (4 * span));
+    float c1, s1, c2, s2, c3, s3;
+    float xr, xi;
+    float b0r, b0i, b1r, b1i, b2r, b2i, b3r, b3i;
+    float t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+    float *p;
+    uint16_t j;
+    uint16_t g;
+
+    for (j = 0; j < span; j++) {
+        static_twiddle_f32((uint16_t)(j * step), &c1, &s1);
+        static_twiddle_f32((uint16_t)(2 * j * step), &c2, &s2);
+        static_twiddle_f32((uint16_t)(3 * j * step), &c3, &s3);
+
+        for (g = j; g < m; g += 4 * span) {
+            p = &p_buf[2 * g];
+
+            b0r = p[0];
+            b0i = p[1];
+            xr = p[4 * span];
+            xi = p[4 * span + 1];
+            b1r = xr * c1 + xi * s1;
+            b1i = xi * c1 - xr * s1;
+            xr = p[2 * span];
+            xi = p[2 * span + 1];
+            b2r = xr * c2 + xi * s2;
+            b2i = xi * c2 - xr * s2;
+            xr = p[6 * span];
+            xi = p[6 * span + 1];
+            b3r = xr * c3 + xi * s3;
+            b3i = xi * c3 - xr * s3;
+
+            t0r = b0r + b2r; t0i = b0i + b2i;
+            t1r = b0r - b2r; t1i = b0i - b2i;
+            t2r = b1r + b3r; t2i = b1i + b3i;
+            t3r = b1r - b3r; t3i = b1i - b3i;
+
+            p[0] = t0r + t2r;
+            p[1] = t0i + t2i;
+            p[2 * span] = t1r + t3i;
+            p[2 * span + 1] = t1i - t3r;
+            p[4 * span] = t0r - t2r;
+            p[4 * span + 1] = t0i - t2i;
+            p[6 * span] = t1r - t3i;
+            p[6 * span + 1] = t1i + t3r;
+        }
+    }
+}
+
+#endif
+
+/**
+ * @brief 由 m 点复数 FFT 结果分离出实数 FFT 的第 k 个频点 (0 <= k <= m), 返回 |X[k]|^2
+ */
+static float static_f32_bin_power(const float *p_buf, uint16_t m, uint16_t k)
+{
+    uint16_t mk = (uint16_t)((m - k) & (m - 1));
+    float ar, ai, br, bi;
+    float dr, di;
+    float c, s;
+    float xr, xi;
+
+    if (k == m) {
+        xr = p_buf[0] - p_buf[1];
+        return xr * xr;
+    }
+
+    ar = p_buf[2 * k];
+    ai = p_buf[2 * k + 1];
+    br = p_buf[2 * mk];
+    bi = -p_buf[2 * mk + 1];
+    dr = ar - br;
+    di = ai - bi;
+
+    static_twiddle_f32((uint16_t)(k * (MPU6050_SPECTRUM_MAX_POINTS / (2 * m))), &c, &s);
+    xr = 0.5f * (ar + br + c * di - s * dr);
+    xi = 0.5f * (ai + bi - c * dr - s * di);
+
+    return xr * xr + xi * xi;
+}
+
+static uint16_t static_f32_to_u16(float value)
+{
+    if (value >= 65535.0f) {
+        return 0xFFFF;
+    }
+    return (uint16_t)(value + 0.5f);
+}
+#endif /* MPU6050_USE_FLOAT */
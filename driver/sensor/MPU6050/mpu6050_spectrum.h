@@ -0,0 +1,237 @@
+/**
+ * @file mpu6050_spectrum.h
+ * @brief MPU6050 振动频谱分析 (Vibration Spectrum Analysis)
+ * @note  从 FIFO 样本中取一个加速度轴组成 N 点数据块 (N 为 2 的幂, 最大 MPU6050_SPECTRUM_MAX_POINTS),
+ *        去直流 (重力) 并加窗后做实数 FFT, 输出紧凑的特征值:
+ *        各频带加速度有效值, 总有效值, 峰值频率与峰值幅值 (mg).
+ *        上传特征值代替原始数据, 无线链路流量约降为 1/85 (N=1024, 8 个频带: 24 字节 / 2048 字节).
+ *        - 实数 FFT: N 个实数按 N/2 点复数做 FFT, 再用一次分离运算得到 0 ~ fs/2 的频谱;
+ *          复数 FFT 为基-4 蝶形 (每个蝶形3次复数乘法), log2(N/2) 为奇数时先做一级基-2
+ *        - 定点 (Q15): 块浮点, 每级蝶形按上一级输出的最大值动态右移, 小幅振动也保留有效位;
+ *          适合无 FPU 的 MCU, 旋转因子与窗函数由同一张 257 项正弦表查得
+ *        - 浮点: 与定点版本输出格式相同, MPU6050_USE_FLOAT 为0时不提供
+ *        - 峰值频率: Hann 窗用相邻3个频点的幅值做插值 (对单频信号无偏), 矩形窗用相邻较大的频点插值
+ *
+ * @section spectrum_simd 向量化
+ * MPU6050_SPECTRUM_USE_SIMD 为1 时浮点版本的基-4 蝶形每次处理2个复数:
+ * 编译器提供 SSE2 (x86) 时默认启用. NEON (ARMv7-A/ARMv8) 实现尚未在 ARM 目标上编译验证,
+ * 默认关闭, 需显式定义为1启用. 定点版本在所有平台上使用可移植实现
+ * (Cortex-M3/M4 上32位乘法为单周期, 块浮点避免了饱和运算).
+ * 主机耗时可用 examples/mpu6050_host_bench.c 测量; 1 kHz 采样, N=1024 时每秒约处理1个数据块,
+ * 在 Cortex-M4 上计算量远小于总线读取 FIFO 的开销.
+ *
+ * @section spectrum_usage 使用示例
+ * @code
+ * static int16_t block[1024];
+ * mpu6050_spectrum_q_t spec;
+ * mpu6050_spectrum_config_t cfg = MPU6050_SPECTRUM_DEFAULT_CONFIG;
+ * mpu6050_spectrum_features_t feat;
+ *
+ * cfg.band_count = 3;
+ * cfg.band_edges_hz[0] = 10; cfg.band_edges_hz[1] = 100;     // 10 ~ 100 Hz
+ * cfg.band_edges_hz[2] = 300; cfg.band_edges_hz[3] = 500;    // 100 ~ 300 Hz, 300 ~ 500 Hz
+ * mpu6050_spectrum_q_init(&spec, &mpu_dev, &cfg, block);
+ *
+ * mpu6050_fifo_read(&mpu_dev, samples, 64, &count);
+ * for (i = 0; i < count; i += used) {
+ *     mpu6050_spectrum_q_feed(&spec, &samples[i], count - i, &used);
+ *     if (mpu6050_spectrum_q_compute(&spec, &feat) == DRV_OK) {
+ *         radio_send(&feat, sizeof(feat));
+ *     }
+ * }
+ * @endcode
+ */
+
+#ifndef _MPU6050_SPECTRUM_H_
+#define _MPU6050_SPECTRUM_H_
+
+#include "mpu6050_driver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* --- 1. 宏定义 (Macros) --- */
+
+#ifndef MPU6050_SPECTRUM_USE_SIMD
+#if defined(__SSE2__)
+#define MPU6050_SPECTRUM_USE_SIMD    1     /**< 1: 主机平台浮点 FFT 使用 SSE2/NEON 向量化实现 (默认只在 SSE2 上启用) */
+#else
+#define MPU6050_SPECTRUM_USE_SIMD    0
+#endif
+#endif
+
+#ifndef MPU6050_SPECTRUM_MAX_BANDS
+#define MPU6050_SPECTRUM_MAX_BANDS   8     /**< 最多频带数 */
+#endif
+
+#define MPU6050_SPECTRUM_MIN_POINTS  16    /**< 最小 FFT 点数 */
+#define MPU6050_SPECTRUM_MAX_POINTS  1024  /**< 最大 FFT 点数 (正弦表分辨率) */
+
+/**
+ * @brief 默认配置: 256 点, Z 轴, Hann 窗, 不分频带 (只输出总有效值与峰值)
+ */
+#define MPU6050_SPECTRUM_DEFAULT_CONFIG  { 256, MPU6050_SPECTRUM_AXIS_Z, MPU6050_SPECTRUM_WINDOW_HANN, 0, { 0 } }
+
+/* --- 2. 数据结构 (Data Structures) --- */
+
+/**
+ * @brief 分析的加速度轴
+ */
+typedef enum {
+    MPU6050_SPECTRUM_AXIS_X = 0,
+    MPU6050_SPECTRUM_AXIS_Y,
+    MPU6050_SPECTRUM_AXIS_Z
+} mpu6050_spectrum_axis_t;
+
+/**
+ * @brief 窗函数
+ */
+typedef enum {
+    MPU6050_SPECTRUM_WINDOW_RECT = 0,  /**< 矩形窗 (不加窗): 频率分辨率高, 频谱泄漏大 */
+    MPU6050_SPECTRUM_WINDOW_HANN       /**< Hann 窗: 旁瓣低, 推荐 */
+} mpu6050_spectrum_window_t;
+
+/**
+ * @brief 频谱分析配置
+ */
+typedef struct {
+    uint16_t points;                     /**< FFT 点数 (2的幂, MIN_POINTS ~ MAX_POINTS) */
+    mpu6050_spectrum_axis_t   axis;      /**< 分析的加速度轴 */
+    mpu6050_spectrum_window_t window;    /**< 窗函数 */
+    uint8_t  band_count;                 /**< 频带数 (0 ~ MPU6050_SPECTRUM_MAX_BANDS) */
+    uint16_t band_edges_hz[MPU6050_SPECTRUM_MAX_BANDS + 1];  /**< 频带边界 (Hz, 递增, 共 band_count + 1 个) */
+} mpu6050_spectrum_config_t;
+
+/**
+ * @brief 频谱特征 (每个数据块输出一次, 可直接作为上传数据)
+ * @note  有效值已按窗函数的能量损失补偿; 不含直流分量; 超出范围时饱和为 0xFFFF
+ */
+typedef struct {
+    uint16_t band_rms_mg[MPU6050_SPECTRUM_MAX_BANDS];  /**< 各频带加速度有效值 (mg) */
+    uint16_t rms_mg;           /**< 0 ~ fs/2 的总有效值 (mg) */
+    uint16_t peak_freq_dhz;    /**< 峰值频率 (0.1 Hz) */
+    uint16_t peak_amp_mg;      /**< 峰值处的正弦幅值 (mg) */
+    uint8_t  band_count;       /**< 有效的频带数 */
+} mpu6050_spectrum_features_t;
+
+/**
+ * @brief 频谱分析公共参数 (由 init 根据配置与设备采样率预先计算)
+ */
+typedef struct {
+    uint16_t points;           /**< FFT 点数 */
+    uint16_t fill;             /**< 当前数据块已填充的样本数 */
+    int32_t  sum;              /**< 当前数据块原始值之和 (用于去直流) */
+    uint32_t bin_dhz_q16;      /**< 频率分辨率 fs / N (0.1 Hz, Q16) */
+    uint16_t band_bin[MPU6050_SPECTRUM_MAX_BANDS + 1];  /**< 频带边界对应的频点 */
+    uint16_t accel_sensitivity;  /**< 加速度计灵敏度 (LSB/g) */
+    uint8_t  band_count;       /**< 频带数 */
+    uint8_t  axis;             /**< 分析的加速度轴 */
+    uint8_t  window;           /**< 窗函数 */
+    bool     is_initialized;   /**< 初始化标志 */
+} mpu6050_spectrum_param_t;
+
+/**
+ * @brief 定点 (Q15) 频谱分析状态
+ * @note  内存由调用者管理
+ */
+typedef struct {
+    mpu6050_spectrum_param_t param;  /**< 公共参数 */
+    int16_t *p_buf;                  /**< 数据块缓冲 (调用者提供, points 个, FFT 原地计算) */
+} mpu6050_spectrum_q_t;
+
+#if MPU6050_USE_FLOAT
+/**
+ * @brief 浮点频谱分析状态
+ * @note  内存由调用者管理
+ */
+typedef struct {
+    mpu6050_spectrum_param_t param;  /**< 公共参数 */
+    float   *p_buf;                  /**< 数据块缓冲 (调用者提供, points 个, FFT 原地计算) */
+} mpu6050_spectrum_t;
+#endif
+
+/* --- 3. API 函数声明 (API Functions) --- */
+
+/**
+ * @brief 初始化定点频谱分析
+ * @param p_spec 频谱分析状态指针
+ * @param p_dev 已初始化的设备句柄 (读取采样周期与加速度计灵敏度)
+ * @param p_config 配置
+ * @param p_buf 数据块缓冲 (至少 p_config->points 个)
+ * @return driver_status_t
+ * @retval DRV_ERR_INVALID_VAL 点数不是 2 的幂或超出范围, 频带边界不递增
+ * @note  采样率或量程改变后需重新调用; 宽度小于频率分辨率 (fs / N) 的频带可能为空
+ */
+driver_status_t mpu6050_spectrum_q_init(mpu6050_spectrum_q_t *p_spec,
+                                        const mpu6050_dev_t *p_dev,
+                                        const mpu6050_spectrum_config_t *p_config,
+                                        int16_t *p_buf);
+
+/**
+ * @brief 向当前数据块填入 FIFO 样本
+ * @param p_spec 频谱分析状态指针
+ * @param p_samples FIFO 样本数组 (需包含加速度数据)
+ * @param count 样本数
+ * @param p_used 实际填入的样本数 (数据块填满后停止, 剩余样本在 compute 之后继续填入)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_spectrum_q_feed(mpu6050_spectrum_q_t *p_spec,
+                                        const mpu6050_fifo_sample_t *p_samples,
+                                        uint16_t count,
+                                        uint16_t *p_used);
+
+/**
+ * @brief 计算已填满的数据块的频谱特征, 并开始下一个数据块
+ * @param p_spec 频谱分析状态指针
+ * @param p_out 特征输出
+ * @return driver_status_t
+ * @retval DRV_ERR_BUSY 数据块尚未填满
+ */
+driver_status_t mpu6050_spectrum_q_compute(mpu6050_spectrum_q_t *p_spec,
+                                           mpu6050_spectrum_features_t *p_out);
+
+#if MPU6050_USE_FLOAT
+/**
+ * @brief 初始化浮点频谱分析
+ * @param p_spec 频谱分析状态指针
+ * @param p_dev 已初始化的设备句柄 (读取采样周期与加速度计灵敏度)
+ * @param p_config 配置
+ * @param p_buf 数据块缓冲 (至少 p_config->points 个)
+ * @return driver_status_t
+ * @retval DRV_ERR_INVALID_VAL 点数不是 2 的幂或超出范围, 频带边界不递增
+ */
+driver_status_t mpu6050_spectrum_init(mpu6050_spectrum_t *p_spec,
+                                      const mpu6050_dev_t *p_dev,
+                                      const mpu6050_spectrum_config_t *p_config,
+                                      float *p_buf);
+
+/**
+ * @brief 向当前数据块填入 FIFO 样本
+ * @param p_spec 频谱分析状态指针
+ * @param p_samples FIFO 样本数组 (需包含加速度数据)
+ * @param count 样本数
+ * @param p_used 实际填入的样本数 (数据块填满后停止)
+ * @return driver_status_t
+ */
+driver_status_t mpu6050_spectrum_feed(mpu6050_spectrum_t *p_spec,
+                                      const mpu6050_fifo_sample_t *p_samples,
+                                      uint16_t count,
+                                      uint16_t *p_used);
+
+/**
+ * @brief 计算已填满的数据块的频谱特征, 并开始下一个数据块
+ * @param p_spec 频谱分析状态指针
+ * @param p_out 特征输出
+ * @return driver_status_t
+ * @retval DRV_ERR_BUSY 数据块尚未填满
+ */
+driver_status_t mpu6050_spectrum_compute(mpu6050_spectrum_t *p_spec,
+                                         mpu6050_spectrum_features_t *p_out);
+#endif /* MPU6050_USE_FLOAT */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MPU6050_SPECTRUM_H_ */
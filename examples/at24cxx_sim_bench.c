@@ -0,0 +1,451 @@
+/**
+ * @file at24cxx_sim_bench.c
+ * @brief AT24Cxx 存储层基准程序 (主机运行, 基于行为模拟器)
+ * @note  复现 AT24Cxx README 中"主机模拟器上"的各项数据.
+ *        构建 (在仓库根目录):
+ *        gcc -std=c99 -O2 -DAT24CXX_MAX_PAGE_SIZE=128 -Icore -Idriver/memory/AT24Cxx -o at24cxx_sim_bench \
+ *            examples/at24cxx_sim_bench.c driver/memory/AT24Cxx/at24cxx_driver.c \
+ *            driver/memory/AT24Cxx/at24cxx_sim.c driver/memory/AT24Cxx/at24cxx_stripe.c \
+ *            driver/memory/AT24Cxx/at24cxx_stream.c driver/memory/AT24Cxx/at24cxx_cfgstore.c \
+ *            core/driver_crc.c
+ *        (AT24C512 页大小为 128 字节, 需要放大 AT24CXX_MAX_PAGE_SIZE)
+ *        时间均为模拟器的虚拟时间 (tWR 5ms, 400kHz), 与主机速度无关.
+ */
+
+#include "at24cxx_cfgstore.h"
+#include "at24cxx_sim.h"
+#include "at24cxx_stream.h"
+#include "at24cxx_stripe.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* --- 1. 模拟环境 (Simulated Environment) --- */
+
+#define BENCH_MAX_CAPACITY  65536U
+
+static at24cxx_sim_clock_t s_clock;
+static uint8_t s_sim_mem[BENCH_MAX_CAPACITY];
+static uint32_t s_sim_wear[BENCH_MAX_CAPACITY];
+static uint8_t s_ref[BENCH_MAX_CAPACITY];
+static uint8_t s_buf[BENCH_MAX_CAPACITY];
+
+static void sim_delay_us(uint32_t us) { at24cxx_sim_clock_advance_us(&s_clock, us); }
+static void sim_delay_ms(uint32_t ms) { at24cxx_sim_clock_advance_us(&s_clock, ms * 1000U); }
+static uint32_t sim_get_tick(void) { return at24cxx_sim_clock_get_ms(&s_clock); }
+
+static const driver_time_ops_t s_time_ops = {
+    .delay_ms = sim_delay_ms,
+    .delay_us = sim_delay_us,
+    .get_tick = sim_get_tick
+};
+
+/**
+ * @brief 建立一颗模拟芯片并以随机数据填充, 同时保存参考副本
+ */
+static void bench_setup(at24cxx_sim_t *p_sim, at24cxx_dev_t *p_dev, at24cxx_model_t model,
+                        const driver_i2c_ops_t *p_ops)
+{
+    at24cxx_sim_config_t sim_config = AT24CXX_SIM_GET_DEFAULT_CONFIG(model);
+    at24cxx_config_t config = AT24CXX_GET_DEFAULT_CONFIG(model);
+    uint32_t i;
+
+    at24cxx_sim_init(p_sim, &sim_config, &s_clock, s_sim_mem, s_sim_wear);
+    for (i = 0; i < sim_config.capacity; i++) {
+        s_sim_mem[i] = s_ref[i] = (uint8_t)rand();
+    }
+
+    at24cxx_init(p_dev, p_ops, &config, p_sim);
+    at24cxx_set_time_ops(p_dev, &s_time_ops);
+}
+
+/* --- 2. 随机读取的总线传输次数 (README 6.2) --- */
+
+static void bench_random_read(at24cxx_model_t model, const char *p_name, bool use_write_read)
+{
+    static const uint32_t sizes[] = { 1, 4, 16, 64, 256, 1000 };
+    at24cxx_sim_t sim;
+    at24cxx_dev_t dev;
+    driver_i2c_ops_t ops;
+    uint32_t block_size, reads = 0, errors = 0, txn_start;
+    uint32_t k, r;
+
+    at24cxx_sim_get_i2c_ops(&ops);
+    if (!use_write_read) {
+        ops.write_read = NULL;
+        ops.write_read_async = NULL;
+    }
+    bench_setup(&sim, &dev, model, &ops);
+
+    /* 1字节地址型号的高位地址在设备地址中, 单次传输不能跨越 256 字节块 */
+    block_size = (dev.config.addr_bytes == 1) ? 256U : dev.config.capacity;
+    txn_start = sim.stats.transaction_count;
+
+    for (k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+        uint32_t length = (sizes[k] < block_size) ? sizes[k] : block_size;
+
+        for (r = 0; r < 50; r++) {
+            uint32_t address = (uint32_t)rand() % (dev.config.capacity - length + 1U);
+
+            /* 调整到块内 */
+            if ((address % block_size) + length > block_size) {
+                address -= (address % block_size) + length - block_size;
+            }
+            if (at24cxx_read(&dev, address, s_buf, length) != DRV_OK ||
+                memcmp(s_buf, &s_ref[address], length) != 0) {
+                errors++;
+            }
+            reads++;
+        }
+    }
+
+    printf("  %-9s %-13s %.2f 次/读取 (%u 次读取, %u 错误)\n", p_name,
+           use_write_read ? "write_read" : "无 write_read",
+           (double)(sim.stats.transaction_count - txn_start) / reads, reads, errors);
+}
+
+/* --- 3. 条带卷顺序写入吞吐量 (README 14) --- */
+
+#define BENCH_STRIPE_LENGTH  16384U
+
+static uint8_t s_stripe_mem[AT24CXX_STRIPE_MAX_CHIPS][32768];
+
+static void bench_stripe_write(uint8_t chip_count)
+{
+    at24cxx_sim_t sims[AT24CXX_STRIPE_MAX_CHIPS];
+    at24cxx_dev_t devs[AT24CXX_STRIPE_MAX_CHIPS];
+    at24cxx_dev_t *p_devs[AT24CXX_STRIPE_MAX_CHIPS];
+    at24cxx_stripe_t volume;
+    driver_i2c_ops_t ops;
+    driver_status_t status;
+    uint64_t start_ns, elapsed_ns;
+    uint8_t i;
+
+    at24cxx_sim_get_i2c_ops(&ops);
+
+    /* 同一总线上的芯片共享虚拟时钟, 总线传输依次占用时间 */
+    for (i = 0; i < chip_count; i++) {
+        at24cxx_sim_config_t sim_config = AT24CXX_SIM_GET_DEFAULT_CONFIG(AT24CXX_MODEL_256);
+        at24cxx_config_t config = AT24CXX_GET_DEFAULT_CONFIG(AT24CXX_MODEL_256);
+
+        sim_config.device_addr = (uint8_t)(0x50U + i);
+        config.device_addr = (uint8_t)((0x50U + i) << 1);
+        at24cxx_sim_init(&sims[i], &sim_config, &s_clock, s_stripe_mem[i], NULL);
+        at24cxx_init(&devs[i], &ops, &config, &sims[i]);
+        at24cxx_set_time_ops(&devs[i], &s_time_ops);
+        p_devs[i] = &devs[i];
+    }
+
+    at24cxx_stripe_init(&volume, p_devs, chip_count);
+
+    for (i = 0; i < BENCH_STRIPE_LENGTH / 256U; i++) {
+        memset(&s_ref[i * 256U], i, 256U);
+    }
+
+    start_ns = s_clock.now_ns;
+    status = at24cxx_stripe_write(&volume, 0, s_ref, BENCH_STRIPE_LENGTH);
+    elapsed_ns = s_clock.now_ns - start_ns;
+
+    at24cxx_stripe_read(&volume, 0, s_buf, BENCH_STRIPE_LENGTH);
+
+    printf("  %u 颗芯片: %.1f KB/s (%.1f ms, 状态 %d, 校验 %s)\n", chip_count,
+           (BENCH_STRIPE_LENGTH / 1024.0) / (elapsed_ns / 1e9), elapsed_ns / 1e6, status,
+           memcmp(s_buf, s_ref, BENCH_STRIPE_LENGTH) == 0 ? "通过" : "失败");
+}
+
+/* --- 4. 读取流逐字节扫描 (README 16) --- */
+
+#define BENCH_SCAN_LENGTH    8192U
+#define BENCH_PARSE_US       20U    /**< 每字节的解析开销 */
+
+/**
+ * @brief 模拟 DMA 的异步读取: 数据立即写入, 完成回调推迟到传输时间结束后,
+ *        期间虚拟时钟归还给 CPU (解析与总线传输并行)
+ */
+static struct {
+    driver_i2c_ops_t sim_ops;
+    bool is_pending;
+    uint64_t due_ns;
+    driver_status_t status;
+    driver_completion_callback_t cb;
+    void *user_data;
+} s_dma;
+
+static void bench_dma_service(void)
+{
+    if (s_dma.is_pending && s_clock.now_ns >= s_dma.due_ns) {
+        s_dma.is_pending = false;
+        s_dma.cb(s_dma.user_data, s_dma.status);
+    }
+}
+
+static driver_status_t bench_dma_write_read(void *ctx, uint8_t dev_addr, const uint8_t *p_tx, uint32_t tx_len,
+                                            uint8_t *p_rx, uint32_t rx_len,
+                                            driver_completion_callback_t cb, void *user_data)
+{
+    uint64_t issue_ns = s_clock.now_ns;
+
+    if (s_dma.is_pending) {
+        return DRV_ERR_BUSY;
+    }
+
+    s_dma.status = s_dma.sim_ops.write_read(ctx, dev_addr, p_tx, tx_len, p_rx, rx_len);
+    s_dma.due_ns = s_clock.now_ns;
+    s_clock.now_ns = issue_ns;
+
+    s_dma.cb = cb;
+    s_dma.user_data = user_data;
+    s_dma.is_pending = true;
+
+    return DRV_OK;
+}
+
+/* 忙等待中的 get_tick 推进时钟, 使挂起的传输能够完成 */
+static uint32_t bench_dma_get_tick(void)
+{
+    at24cxx_sim_clock_advance_us(&s_clock, 1U);
+    bench_dma_service();
+    return at24cxx_sim_clock_get_ms(&s_clock);
+}
+
+static const driver_time_ops_t s_dma_time_ops = {
+    .delay_ms = sim_delay_ms,
+    .delay_us = sim_delay_us,
+    .get_tick = bench_dma_get_tick
+};
+
+static void bench_stream_scan(const char *p_name, uint16_t buf_size, bool async_prefetch)
+{
+    static uint8_t stream_buf[512];
+    at24cxx_sim_t sim;
+    at24cxx_dev_t dev;
+    at24cxx_stream_t stream;
+    driver_i2c_ops_t ops;
+    uint32_t txn_start, errors = 0, i;
+    uint64_t start_ns;
+    uint8_t byte;
+    driver_status_t status;
+
+    memset(&s_dma, 0, sizeof(s_dma));
+    at24cxx_sim_get_i2c_ops(&s_dma.sim_ops);
+    ops = s_dma.sim_ops;
+    ops.write_read_async = bench_dma_write_read;
+
+    bench_setup(&sim, &dev, AT24CXX_MODEL_256, &ops);
+    at24cxx_set_time_ops(&dev, &s_dma_time_ops);
+
+    if (buf_size > 0) {
+        at24cxx_stream_init(&stream, &dev, stream_buf, buf_size, async_prefetch);
+    }
+
+    txn_start = sim.stats.transaction_count;
+    start_ns = s_clock.now_ns;
+
+    for (i = 0; i < BENCH_SCAN_LENGTH; i++) {
+        if (buf_size > 0) {
+            status = at24cxx_stream_read_byte(&stream, &byte);
+        } else {
+            status = at24cxx_read(&dev, i, &byte, 1);
+        }
+
+        if (status != DRV_OK || byte != s_ref[i]) {
+            errors++;
+        }
+
+        at24cxx_sim_clock_advance_us(&s_clock, BENCH_PARSE_US);
+        bench_dma_service();
+    }
+
+    printf("  %s: %u 次传输, %.1f ms (%u 错误)\n", p_name,
+           sim.stats.transaction_count - txn_start, (s_clock.now_ns - start_ns) / 1e6, errors);
+}
+
+/* --- 5. 耐久与掉电测试 (README 17) --- */
+
+#define BENCH_ENDURANCE_WRITES  10000U
+#define BENCH_POWER_LOSS_SAVES  2000U
+#define BENCH_CONFIG_SIZE       300U
+
+static void bench_endurance(void)
+{
+    at24cxx_sim_t sim;
+    at24cxx_dev_t dev;
+    driver_i2c_ops_t ops;
+    uint64_t start_ns;
+    clock_t start_clock;
+    uint32_t errors = 0, i;
+
+    at24cxx_sim_get_i2c_ops(&ops);
+    bench_setup(&sim, &dev, AT24CXX_MODEL_256, &ops);
+
+    start_ns = s_clock.now_ns;
+    start_clock = clock();
+
+    for (i = 0; i < BENCH_ENDURANCE_WRITES; i++) {
+        if (at24cxx_write(&dev, 64, &s_ref[i % 256U], 16) != DRV_OK) {
+            errors++;
+        }
+    }
+
+    printf("  同一 16 字节区域写入 %u 次: 模拟时间 %.1f s, 主机耗时 %.1f ms, 最大单字节写入 %u 次 (%u 错误)\n",
+           BENCH_ENDURANCE_WRITES, (s_clock.now_ns - start_ns) / 1e9,
+           (double)(clock() - start_clock) * 1000.0 / CLOCKS_PER_SEC, sim.stats.max_cell_writes, errors);
+}
+
+/**
+ * @brief 掉电注入: 在第 N 次页写入时断电 (N 随机), 只提交随机数量的字节
+ */
+static struct {
+    driver_i2c_ops_t sim_ops;
+    uint32_t countdown;
+} s_power_loss;
+
+static driver_status_t bench_power_loss_write_reg(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                                  const uint8_t *p_data, uint32_t len)
+{
+    at24cxx_sim_t *p_sim = (at24cxx_sim_t *)ctx;
+
+    if (s_power_loss.countdown > 0 && --s_power_loss.countdown == 0) {
+        at24cxx_sim_inject_power_loss(p_sim, (uint32_t)rand() % (p_sim->config.page_size + 1U));
+    }
+
+    return s_power_loss.sim_ops.write_reg(ctx, dev_addr, reg_addr, p_data, len);
+}
+
+static void bench_cfgstore_power_loss(void)
+{
+    static uint8_t current[BENCH_CONFIG_SIZE], pending[BENCH_CONFIG_SIZE], loaded[BENCH_CONFIG_SIZE];
+    at24cxx_cfgstore_config_t store_config = { .base_address = 1024, .slot_size = 512 };
+    at24cxx_cfgstore_t store;
+    at24cxx_sim_t sim;
+    at24cxx_dev_t dev;
+    driver_i2c_ops_t ops;
+    uint32_t interrupted = 0, old_kept = 0, lost = 0, i, k;
+    uint16_t length;
+
+    at24cxx_sim_get_i2c_ops(&s_power_loss.sim_ops);
+    ops = s_power_loss.sim_ops;
+    ops.write_reg = bench_power_loss_write_reg;
+    s_power_loss.countdown = 0;
+
+    bench_setup(&sim, &dev, AT24CXX_MODEL_256, &ops);
+    at24cxx_cfgstore_init(&store, &dev, &store_config);
+    memset(current, 0, sizeof(current));
+    at24cxx_cfgstore_save(&store, current, sizeof(current));
+
+    for (i = 0; i < BENCH_POWER_LOSS_SAVES; i++) {
+        for (k = 0; k < sizeof(pending); k++) {
+            pending[k] = (uint8_t)rand();
+        }
+
+        /* 约一半的保存在随机位置掉电 */
+        s_power_loss.countdown = (rand() % 2 != 0) ? 1U + (uint32_t)rand() % 8U : 0U;
+
+        at24cxx_cfgstore_save(&store, pending, sizeof(pending));
+        if (!sim.is_powered) {
+            interrupted++;
+            at24cxx_sim_power_on(&sim);
+        }
+        s_power_loss.countdown = 0;
+
+        /* 重新上电: 必须加载到旧配置或新配置之一 */
+        at24cxx_cfgstore_init(&store, &dev, &store_config);
+        if (at24cxx_cfgstore_load(&store, loaded, sizeof(loaded), &length) != DRV_OK ||
+            length != sizeof(loaded)) {
+            lost++;
+        } else if (memcmp(loaded, pending, sizeof(loaded)) == 0) {
+            memcpy(current, pending, sizeof(current));
+        } else if (memcmp(loaded, current, sizeof(loaded)) == 0) {
+            old_kept++;
+        } else {
+            lost++;
+        }
+    }
+
+    printf("  配置存储保存 %u 次: 掉电中断 %u 次, 保留旧配置 %u 次, 配置损坏/丢失 %u 次\n",
+           BENCH_POWER_LOSS_SAVES, interrupted, old_kept, lost);
+}
+
+/* --- 6. 整片擦除 (README 8.2) --- */
+
+/**
+ * @param dirty_percent 含非 0xFF 数据的页所占百分比
+ */
+static void bench_erase_chip(const char *p_name, uint32_t dirty_percent, bool skip_erased)
+{
+    at24cxx_sim_t sim;
+    at24cxx_dev_t dev;
+    driver_i2c_ops_t ops;
+    at24cxx_sim_stats_t start_stats;
+    uint64_t start_ns;
+    uint32_t page_size, page, remaining = 0, i;
+    driver_status_t status;
+
+    at24cxx_sim_get_i2c_ops(&ops);
+    bench_setup(&sim, &dev, AT24CXX_MODEL_256, &ops);
+    page_size = dev.config.page_size;
+
+    memset(s_sim_mem, 0xFF, dev.config.capacity);
+    for (page = 0; page < dev.config.capacity / page_size; page++) {
+        if ((uint32_t)rand() % 100U < dirty_percent) {
+            s_sim_mem[page * page_size + (uint32_t)rand() % page_size] = 0x00;
+        }
+    }
+
+    start_stats = sim.stats;
+    start_ns = s_clock.now_ns;
+
+    status = at24cxx_erase_chip(&dev, skip_erased);
+
+    for (i = 0; i < dev.config.capacity; i++) {
+        if (s_sim_mem[i] != 0xFF) {
+            remaining++;
+        }
+    }
+
+    printf("  %s: %.0f ms, %u 次传输, %u 次页写入 (状态 %d, 残留 %u 字节)\n", p_name,
+           (s_clock.now_ns - start_ns) / 1e6,
+           sim.stats.transaction_count - start_stats.transaction_count,
+           sim.stats.page_write_count - start_stats.page_write_count, status, remaining);
+}
+
+/* --- 7. 入口 (Entry) --- */
+
+int main(void)
+{
+    srand(1);
+
+    printf("随机读取 (1 ~ 1000 字节, 不跨越块; AT24C16 每块 256 字节):\n");
+    bench_random_read(AT24CXX_MODEL_16, "AT24C16", false);
+    bench_random_read(AT24CXX_MODEL_16, "AT24C16", true);
+    bench_random_read(AT24CXX_MODEL_256, "AT24C256", false);
+    bench_random_read(AT24CXX_MODEL_256, "AT24C256", true);
+    bench_random_read(AT24CXX_MODEL_512, "AT24C512", false);
+    bench_random_read(AT24CXX_MODEL_512, "AT24C512", true);
+
+
+    printf("16KB 顺序写入条带卷 (AT24C256):\n");
+    bench_stripe_write(1);
+    bench_stripe_write(2);
+    bench_stripe_write(3);
+    bench_stripe_write(4);
+
+    printf("逐字节扫描 8KB (AT24C256, 每字节 %u us 解析开销):\n", BENCH_PARSE_US);
+    bench_stream_scan("每字节 at24cxx_read()", 0, false);
+    bench_stream_scan("读取流, 同步 64 字节", 64, false);
+    bench_stream_scan("读取流, 同步 256 字节", 256, false);
+    bench_stream_scan("读取流, 双缓冲 2x64 字节", 128, true);
+
+    printf("耐久与掉电 (AT24C256):\n");
+    bench_endurance();
+    bench_cfgstore_power_loss();
+
+    printf("整片擦除 (AT24C256):\n");
+    bench_erase_chip("skip_erased = false", 100, false);
+    bench_erase_chip("skip_erased = true, 全部页非空白", 100, true);
+    bench_erase_chip("skip_erased = true, 10% 的页非空白", 10, true);
+    bench_erase_chip("skip_erased = true, 空白芯片", 0, true);
+
+    return 0;
+}
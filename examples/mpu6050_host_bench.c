@@ -0,0 +1,216 @@
+/**
+ * @file mpu6050_host_bench.c
+ * @brief MPU6050 数据处理模块的主机基准程序
+ * @note  测量 README 中批量转换与频谱分析的主机吞吐量. 设备通过寄存器数组模拟的 I2C 初始化,
+ *        不需要硬件. 构建 (在仓库根目录):
+ *        gcc -std=c99 -O2 -Icore -Idriver/sensor/MPU6050 -o mpu6050_host_bench \
+ *            examples/mpu6050_host_bench.c driver/sensor/MPU6050/mpu6050_driver.c \
+ *            driver/sensor/MPU6050/mpu6050_convert.c driver/sensor/MPU6050/mpu6050_spectrum.c -lm
+ *        加 -DMPU6050_CONVERT_USE_SIMD=0 -DMPU6050_SPECTRUM_USE_SIMD=0 构建即得到可移植实现的结果.
+ *        结果取决于主机, 应在同一台机器上比较不同实现.
+ */
+
+#include "mpu6050_convert.h"
+#include "mpu6050_spectrum.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* --- 1. 模拟设备 (Simulated Device) --- */
+
+static uint8_t s_regs[128];
+
+static driver_status_t bench_write_reg(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                       const uint8_t *p_data, uint32_t len)
+{
+    (void)ctx;
+    (void)dev_addr;
+    memcpy(&s_regs[reg_addr & 0x7FU], p_data, len);
+    return DRV_OK;
+}
+
+static driver_status_t bench_read_reg(void *ctx, uint8_t dev_addr, uint8_t reg_addr,
+                                      uint8_t *p_data, uint32_t len)
+{
+    (void)ctx;
+    (void)dev_addr;
+    memcpy(p_data, &s_regs[reg_addr & 0x7FU], len);
+    return DRV_OK;
+}
+
+static void bench_delay_ms(uint32_t ms) { (void)ms; }
+
+static mpu6050_dev_t s_dev;
+
+static void bench_device_init(void)
+{
+    static int bus_ctx;
+    driver_i2c_ops_t i2c_ops = { 0 };
+    driver_time_ops_t time_ops = { 0 };
+    mpu6050_config_t config = { MPU6050_GYRO_FS_2000, MPU6050_ACCEL_FS_4, MPU6050_DLPF_BW_44, 0 };
+
+    i2c_ops.write_reg = bench_write_reg;
+    i2c_ops.read_reg = bench_read_reg;
+    time_ops.delay_ms = bench_delay_ms;
+
+    s_regs[0x75] = 0x68;    /* WHO_AM_I */
+    mpu6050_init(&s_dev, &i2c_ops, &time_ops, &bus_ctx, MPU6050_ADDR_AD0_LOW, &config);
+}
+
+/* --- 2. 批量转换吞吐量 (README 8) --- */
+
+#define BENCH_FRAMES       4096U
+#define BENCH_FRAME_SIZE   14U
+#define BENCH_ROUNDS       2000U
+
+static uint8_t s_frames[BENCH_FRAMES * BENCH_FRAME_SIZE];
+static float s_f32[6][BENCH_FRAMES];
+static int32_t s_q16[6][BENCH_FRAMES];
+
+/* mpu6050_read_all 的方式: 每轴一次除法 */
+static void bench_divide(const uint8_t *p_frames, uint32_t count)
+{
+    float accel_lsb = (float)s_dev.accel_sensitivity;
+    float gyro_lsb = s_dev.gyro_sensitivity;
+    uint32_t i, axis;
+
+    for (i = 0; i < count; i++) {
+        const uint8_t *p = p_frames + i * BENCH_FRAME_SIZE;
+
+        for (axis = 0; axis < 3; axis++) {
+            s_f32[axis][i] = (float)(int16_t)((p[2 * axis] << 8) | p[2 * axis + 1]) / accel_lsb;
+            s_f32[3 + axis][i] = (float)(int16_t)((p[8 + 2 * axis] << 8) | p[9 + 2 * axis]) / gyro_lsb;
+        }
+    }
+}
+
+static double bench_rate(clock_t start)
+{
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    return (double)BENCH_FRAMES * BENCH_ROUNDS / seconds;
+}
+
+static void bench_convert(void)
+{
+    mpu6050_convert_t conv;
+    mpu6050_soa_f32_t out_f32 = { s_f32[0], s_f32[1], s_f32[2], s_f32[3], s_f32[4], s_f32[5] };
+    mpu6050_soa_q16_t out_q16 = { s_q16[0], s_q16[1], s_q16[2], s_q16[3], s_q16[4], s_q16[5] };
+    clock_t start;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(s_frames); i++) {
+        s_frames[i] = (uint8_t)rand();
+    }
+
+    mpu6050_convert_init(&conv, &s_dev, MPU6050_FIFO_ACCEL | MPU6050_FIFO_TEMP | MPU6050_FIFO_GYRO);
+
+    printf("批量转换 (%u 帧 x %u 轮, 14 bytes/帧, %s):\n", BENCH_FRAMES, BENCH_ROUNDS,
+#if MPU6050_CONVERT_USE_SIMD && defined(__SSE2__)
+           "SSE2");
+#else
+           "可移植实现");
+#endif
+
+    start = clock();
+    for (i = 0; i < BENCH_ROUNDS; i++) {
+        bench_divide(s_frames, BENCH_FRAMES);
+    }
+    printf("  逐轴除法:  %.2f 亿样本/秒 (s_f32[0][1] = %.3f)\n", bench_rate(start) / 1e8, s_f32[0][1]);
+
+    start = clock();
+    for (i = 0; i < BENCH_ROUNDS; i++) {
+        mpu6050_convert_f32(&conv, s_frames, BENCH_FRAMES, &out_f32);
+    }
+    printf("  浮点 SoA:  %.2f 亿样本/秒 (s_f32[0][1] = %.3f)\n", bench_rate(start) / 1e8, s_f32[0][1]);
+
+    start = clock();
+    for (i = 0; i < BENCH_ROUNDS; i++) {
+        mpu6050_convert_q16(&conv, s_frames, BENCH_FRAMES, &out_q16);
+    }
+    printf("  Q16.16:    %.2f 亿样本/秒 (s_q16[0][1] = %ld)\n", bench_rate(start) / 1e8, (long)s_q16[0][1]);
+}
+
+/* --- 3. 频谱分析 (README 15) --- */
+
+#define BENCH_SPECTRUM_BLOCKS  (1024U * 1024U)   /* 每种点数处理的总样本数 */
+
+static mpu6050_fifo_sample_t s_samples[MPU6050_SPECTRUM_MAX_POINTS];
+static int16_t s_block_q[MPU6050_SPECTRUM_MAX_POINTS];
+static float s_block_f32[MPU6050_SPECTRUM_MAX_POINTS];
+
+/* 返回每个数据块的耗时 (us), 包含填入, 去直流, 加窗, FFT 与特征计算 */
+static double bench_spectrum_run(const mpu6050_spectrum_config_t *p_cfg, bool fixed,
+                                 mpu6050_spectrum_features_t *p_feat)
+{
+    mpu6050_spectrum_q_t spec_q;
+    mpu6050_spectrum_t spec_f32;
+    uint32_t blocks = BENCH_SPECTRUM_BLOCKS / p_cfg->points;
+    uint16_t used;
+    clock_t start;
+    uint32_t i;
+
+    mpu6050_spectrum_q_init(&spec_q, &s_dev, p_cfg, s_block_q);
+    mpu6050_spectrum_init(&spec_f32, &s_dev, p_cfg, s_block_f32);
+
+    start = clock();
+    for (i = 0; i < blocks; i++) {
+        if (fixed) {
+            mpu6050_spectrum_q_feed(&spec_q, s_samples, p_cfg->points, &used);
+            mpu6050_spectrum_q_compute(&spec_q, p_feat);
+        } else {
+            mpu6050_spectrum_feed(&spec_f32, s_samples, p_cfg->points, &used);
+            mpu6050_spectrum_compute(&spec_f32, p_feat);
+        }
+    }
+
+    return (double)(clock() - start) / CLOCKS_PER_SEC * 1e6 / blocks;
+}
+
+static void bench_spectrum(void)
+{
+    mpu6050_spectrum_config_t cfg = MPU6050_SPECTRUM_DEFAULT_CONFIG;
+    mpu6050_spectrum_features_t feat;
+    uint16_t points;
+    uint32_t i;
+
+    /* 1g 重力 + 120 Hz / 50 mg 正弦 + 噪声 (1 kHz 采样, ±4g: 8192 LSB/g) */
+    for (i = 0; i < MPU6050_SPECTRUM_MAX_POINTS; i++) {
+        s_samples[i].accel.z = (int16_t)(8192 + 410.0 * sin(2.0 * 3.14159265358979 * 120.0 * i / 1000.0) +
+                                         rand() % 33 - 16);
+    }
+
+    cfg.band_count = 2;
+    cfg.band_edges_hz[0] = 10;
+    cfg.band_edges_hz[1] = 100;
+    cfg.band_edges_hz[2] = 500;
+
+    printf("频谱分析 (us/块, %s):\n",
+#if MPU6050_SPECTRUM_USE_SIMD && defined(__SSE2__)
+           "浮点 SSE2");
+#else
+           "浮点 可移植实现");
+#endif
+
+    for (points = 256; points <= MPU6050_SPECTRUM_MAX_POINTS; points *= 4) {
+        cfg.points = points;
+        printf("  N=%-4u 定点 Q15: %.1f", points, bench_spectrum_run(&cfg, true, &feat));
+        printf(", 浮点: %.1f (峰值 %.1f Hz, %u mg)\n", bench_spectrum_run(&cfg, false, &feat),
+               feat.peak_freq_dhz / 10.0, feat.peak_amp_mg);
+    }
+}
+
+/* --- 4. 入口 (Entry) --- */
+
+int main(void)
+{
+    srand(1);
+    bench_device_init();
+
+    bench_convert();
+    bench_spectrum();
+
+    return 0;
+}